@@ -40,6 +40,7 @@
 #include "rxx/algorithm/search_n.h"
 #include "rxx/algorithm/set_operations.h"
 #include "rxx/algorithm/shift.h"
+#include "rxx/algorithm/shuffle.h"
 #include "rxx/algorithm/sort.h"
 #include "rxx/algorithm/starts_with.h"
 #include "rxx/algorithm/swap_ranges.h"
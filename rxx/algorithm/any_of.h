@@ -3,13 +3,40 @@
 
 #include "rxx/config.h"
 
-#include <algorithm>
+#include "rxx/algorithm/find.h"
+#include "rxx/functional/identity.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+namespace details {
+struct any_of_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity,
+        std::indirect_unary_predicate<std::projected<I, Proj>> Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr bool operator()(
+        I first, S last, Pred pred, Proj proj = {}) RXX_CONST_CALL {
+        return find_if_t{}(__RXX move(first), last, __RXX move(pred),
+                   __RXX move(proj)) != last;
+    }
+
+    template <input_range R, typename Proj = identity,
+        std::indirect_unary_predicate<std::projected<iterator_t<R>, Proj>> Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr bool operator()(
+        R&& range, Pred pred, Proj proj = {}) RXX_CONST_CALL {
+        return any_of_t{}(ranges::begin(range), ranges::end(range),
+            __RXX move(pred), __RXX move(proj));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::any_of;
+inline constexpr details::any_of_t any_of{};
 }
 } // namespace ranges
 RXX_DEFAULT_NAMESPACE_END
@@ -4,17 +4,17 @@
 #include "rxx/config.h"
 
 #include "rxx/algorithm/return_types.h"
+#include "rxx/details/view_traits.h"
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
 
 #include <algorithm>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
-inline namespace cpo {
-using std::ranges::copy;
-using std::ranges::copy_backward;
-using std::ranges::copy_if;
-using std::ranges::copy_n;
-} // namespace cpo
 template <typename I, typename O>
 using copy_result = in_out_result<I, O>;
 template <typename I, typename O>
@@ -24,5 +24,58 @@ using copy_n_result = in_out_result<I, O>;
 template <typename I1, typename I2>
 using copy_backward_result = in_out_result<I1, I2>;
 
+namespace details {
+struct copy_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        std::weakly_incrementable O>
+    requires std::indirectly_copyable<I, O>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr copy_result<I, O> operator()(
+        I first, S last, O out) RXX_CONST_CALL {
+        if constexpr (segmented_iterator<I, S>) {
+            // Each segment reaches the library's memmove path on its own
+            auto end = ranges::for_each_segment(__RXX move(first),
+                __RXX move(last), [&](auto local, auto local_last) {
+                    auto result = copy_t{}(
+                        __RXX move(local), __RXX move(local_last),
+                        __RXX move(out));
+                    out = __RXX move(result.out);
+                    return __RXX move(result.in);
+                });
+            return {__RXX move(end), __RXX move(out)};
+        } else {
+            auto result = std::ranges::copy(
+                __RXX move(first), __RXX move(last), __RXX move(out));
+            return {__RXX move(result.in), __RXX move(result.out)};
+        }
+    }
+
+    template <input_range R, std::weakly_incrementable O>
+    requires std::indirectly_copyable<iterator_t<R>, O>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr copy_result<
+        borrowed_iterator_t<R>, O>
+    operator()(R&& range, O out) RXX_CONST_CALL {
+        if constexpr (is_repeat_view_like<std::remove_cvref_t<R>> &&
+            sized_range<R> && std::output_iterator<O, range_reference_t<R>>) {
+            // Every element is the same value, so this is a fill
+            out = std::ranges::fill_n(__RXX move(out),
+                static_cast<iter_difference_t<O>>(ranges::size(range)),
+                *ranges::begin(range));
+            return {ranges::end(range), __RXX move(out)};
+        } else {
+            auto result = copy_t{}(
+                ranges::begin(range), ranges::end(range), __RXX move(out));
+            return {__RXX move(result.in), __RXX move(result.out)};
+        }
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::copy_t copy{};
+using std::ranges::copy_backward;
+using std::ranges::copy_if;
+using std::ranges::copy_n;
+} // namespace cpo
+
 } // namespace ranges
 RXX_DEFAULT_NAMESPACE_END
@@ -3,12 +3,75 @@
 
 #include "rxx/config.h"
 
+#include "rxx/details/strided_scan.h"
+#include "rxx/functional/equal_to.h"
+#include "rxx/functional/identity.h"
+#include "rxx/iterator/iter_traits.h"
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
+
 #include <algorithm>
+#include <functional>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
+
+namespace details {
+struct count_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity, typename T = projected_value_t<I, Proj>>
+    requires std::indirect_binary_predicate<equal_to, std::projected<I, Proj>,
+        T const*>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr iter_difference_t<I> operator()(
+        I first, S last, T const& value, Proj proj = {}) RXX_CONST_CALL {
+        if constexpr (segmented_iterator<I, S>) {
+            iter_difference_t<I> result = 0;
+            ranges::for_each_segment(__RXX move(first), __RXX move(last),
+                [&](auto local, auto local_last) {
+                    if constexpr (std::same_as<decltype(local),
+                                      decltype(local_last)>) {
+                        result += count_t{}(local, local_last, value, proj);
+                        return local_last;
+                    } else {
+                        for (; local != local_last; ++local) {
+                            if (std::invoke(proj, *local) == value) {
+                                ++result;
+                            }
+                        }
+                        return local;
+                    }
+                });
+            return result;
+        } else if constexpr (details::strided_scalar_range<I, S> &&
+            std::same_as<Proj, identity> && std::same_as<T, iter_value_t<I>>) {
+            return details::strided_count(first, last - first, value);
+        } else if constexpr (std::same_as<Proj, identity>) {
+            return std::ranges::count(
+                __RXX move(first), __RXX move(last), value);
+        } else {
+            return std::ranges::count(
+                __RXX move(first), __RXX move(last), value, __RXX move(proj));
+        }
+    }
+
+    template <input_range R, typename Proj = identity,
+        typename T = projected_value_t<iterator_t<R>, Proj>>
+    requires std::indirect_binary_predicate<equal_to,
+        std::projected<iterator_t<R>, Proj>, T const*>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr range_difference_t<R> operator()(
+        R&& range, T const& value, Proj proj = {}) RXX_CONST_CALL {
+        return count_t{}(
+            ranges::begin(range), ranges::end(range), value, __RXX move(proj));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::count;
+inline constexpr details::count_t count{};
 using std::ranges::count_if;
 } // namespace cpo
 } // namespace ranges
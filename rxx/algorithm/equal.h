@@ -3,13 +3,139 @@
 
 #include "rxx/config.h"
 
+#include "rxx/functional/equal_to.h"
+#include "rxx/functional/identity.h"
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/utility.h"
+
 #include <algorithm>
+#include <functional>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+namespace details {
+struct equal_t {
+private:
+    /**
+     * Compares [first1, last1) segment by segment against the front of
+     * [first2, last2), advancing `first2` past the compared elements. Where
+     * both sides are random access the library's `equal` is used for the
+     * whole segment so that it can reach memcmp.
+     */
+    template <typename I1, typename S1, typename I2, typename S2,
+        typename Pred, typename Proj1, typename Proj2>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr bool segmented(I1 first1, S1 last1, I2& first2,
+        S2 const& last2, Pred& pred, Proj1& proj1, Proj2& proj2) {
+        bool matched = true;
+        ranges::for_each_segment(__RXX move(first1), __RXX move(last1),
+            [&](auto local, auto local_last) {
+                using L = decltype(local);
+                if constexpr (std::sized_sentinel_for<decltype(local_last),
+                                  L> &&
+                    std::random_access_iterator<L> &&
+                    std::random_access_iterator<I2> &&
+                    std::sized_sentinel_for<S2, I2>) {
+                    auto const count = local_last - local;
+                    auto const available = last2 - first2;
+                    if (available < count) {
+                        matched = false;
+                        return local;
+                    }
+
+                    auto const mid = first2 + iter_difference_t<I2>(count);
+                    auto const local_end = local + count;
+                    if (!impl(local, local_end, first2, mid, pred, proj1,
+                            proj2)) {
+                        matched = false;
+                        return local;
+                    }
+
+                    first2 = mid;
+                    return local_end;
+                } else {
+                    auto result = std::ranges::mismatch(__RXX move(local),
+                        local_last, __RXX move(first2), last2, std::ref(pred),
+                        std::ref(proj1), std::ref(proj2));
+                    first2 = __RXX move(result.in2);
+                    if (result.in1 != local_last) {
+                        matched = false;
+                    }
+                    return __RXX move(result.in1);
+                }
+            });
+
+        return matched;
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2,
+        typename Pred, typename Proj1, typename Proj2>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
+        Pred& pred, Proj1& proj1, Proj2& proj2) {
+        if constexpr (segmented_iterator<I1, S1>) {
+            if constexpr (std::sized_sentinel_for<S1, I1> &&
+                std::sized_sentinel_for<S2, I2>) {
+                if (ranges::distance(first1, last1) !=
+                    ranges::distance(first2, last2)) {
+                    return false;
+                }
+            }
+
+            return segmented(__RXX move(first1), __RXX move(last1), first2,
+                       last2, pred, proj1, proj2) &&
+                first2 == last2;
+        } else if constexpr (std::same_as<Pred, equal_to> &&
+            std::same_as<Proj1, identity> && std::same_as<Proj2, identity>) {
+            // Only the standard function objects select memcmp
+            return std::ranges::equal(__RXX move(first1), __RXX move(last1),
+                __RXX move(first2), __RXX move(last2));
+        } else {
+            return std::ranges::equal(__RXX move(first1), __RXX move(last1),
+                __RXX move(first2), __RXX move(last2), std::ref(pred),
+                std::ref(proj1), std::ref(proj2));
+        }
+    }
+
+public:
+    template <std::input_iterator I1, std::sentinel_for<I1> S1,
+        std::input_iterator I2, std::sentinel_for<I2> S2,
+        typename Pred = equal_to, typename Proj1 = identity,
+        typename Proj2 = identity>
+    requires std::indirectly_comparable<I1, I2, Pred, Proj1, Proj2>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr bool operator()(I1 first1, S1 last1, I2 first2,
+        S2 last2, Pred pred = {}, Proj1 proj1 = {},
+        Proj2 proj2 = {}) RXX_CONST_CALL {
+        return impl(__RXX move(first1), __RXX move(last1), __RXX move(first2),
+            __RXX move(last2), pred, proj1, proj2);
+    }
+
+    template <input_range R1, input_range R2, typename Pred = equal_to,
+        typename Proj1 = identity, typename Proj2 = identity>
+    requires std::indirectly_comparable<iterator_t<R1>, iterator_t<R2>, Pred,
+        Proj1, Proj2>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr bool operator()(R1&& range1, R2&& range2,
+        Pred pred = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) RXX_CONST_CALL {
+        if constexpr (sized_range<R1> && sized_range<R2>) {
+            if (ranges::distance(range1) != ranges::distance(range2)) {
+                return false;
+            }
+        }
+
+        return impl(ranges::begin(range1), ranges::end(range1),
+            ranges::begin(range2), ranges::end(range2), pred, proj1, proj2);
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::equal;
+inline constexpr details::equal_t equal{};
 }
 
 } // namespace ranges
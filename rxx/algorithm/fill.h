@@ -3,13 +3,45 @@
 
 #include "rxx/config.h"
 
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
+
 #include <algorithm>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+namespace details {
+struct fill_t {
+    template <typename T, std::output_iterator<T const&> O,
+        std::sentinel_for<O> S>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr O operator()(
+        O first, S last, T const& value) RXX_CONST_CALL {
+        if constexpr (segmented_iterator<O, S>) {
+            return ranges::for_each_segment(__RXX move(first),
+                __RXX move(last), [&](auto local, auto local_last) {
+                    return fill_t{}(
+                        __RXX move(local), __RXX move(local_last), value);
+                });
+        } else {
+            return std::ranges::fill(
+                __RXX move(first), __RXX move(last), value);
+        }
+    }
+
+    template <typename T, output_range<T const&> R>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr borrowed_iterator_t<R>
+    operator()(R&& range, T const& value) RXX_CONST_CALL {
+        return fill_t{}(ranges::begin(range), ranges::end(range), value);
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::fill;
+inline constexpr details::fill_t fill{};
 using std::ranges::fill_n;
 } // namespace cpo
 } // namespace ranges
@@ -3,13 +3,102 @@
 
 #include "rxx/config.h"
 
+#include "rxx/details/strided_scan.h"
+#include "rxx/functional/equal_to.h"
+#include "rxx/functional/identity.h"
+#include "rxx/iterator/for_each_while.h"
+#include "rxx/iterator/iter_traits.h"
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
+
 #include <algorithm>
+#include <functional>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
+
+namespace details {
+struct find_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity, typename T = projected_value_t<I, Proj>>
+    requires std::indirect_binary_predicate<equal_to, std::projected<I, Proj>,
+        T const*>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, T const& value, Proj proj = {}) RXX_CONST_CALL {
+        if constexpr (segmented_iterator<I, S>) {
+            return ranges::for_each_segment(__RXX move(first),
+                __RXX move(last), [&](auto local, auto local_last) {
+                    return find_t{}(
+                        __RXX move(local), __RXX move(local_last), value, proj);
+                });
+        } else if constexpr (details::strided_scalar_range<I, S> &&
+            std::same_as<Proj, identity> && std::same_as<T, iter_value_t<I>>) {
+            return first + details::strided_find(first, last - first, value);
+        } else if constexpr (std::same_as<Proj, identity>) {
+            // Only the standard projection selects memchr
+            return std::ranges::find(
+                __RXX move(first), __RXX move(last), value);
+        } else {
+            return std::ranges::find(
+                __RXX move(first), __RXX move(last), value, __RXX move(proj));
+        }
+    }
+
+    template <input_range R, typename Proj = identity,
+        typename T = projected_value_t<iterator_t<R>, Proj>>
+    requires std::indirect_binary_predicate<equal_to,
+        std::projected<iterator_t<R>, Proj>, T const*>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr borrowed_iterator_t<R> operator()(
+        R&& range, T const& value, Proj proj = {}) RXX_CONST_CALL {
+        return find_t{}(
+            ranges::begin(range), ranges::end(range), value, __RXX move(proj));
+    }
+};
+
+struct find_if_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity,
+        std::indirect_unary_predicate<std::projected<I, Proj>> Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, Pred pred, Proj proj = {}) RXX_CONST_CALL {
+        if constexpr (segmented_iterator<I, S>) {
+            return ranges::for_each_segment(__RXX move(first),
+                __RXX move(last), [&](auto local, auto local_last) {
+                    return find_if_t{}(
+                        __RXX move(local), __RXX move(local_last), pred, proj);
+                });
+        } else if constexpr (has_for_each_while<I, S>) {
+            return ranges::for_each_while(__RXX move(first), __RXX move(last),
+                [&]<typename T>(T&& element) -> bool {
+                    return !std::invoke(
+                        pred, std::invoke(proj, __RXX forward<T>(element)));
+                });
+        } else {
+            return std::ranges::find_if(__RXX move(first), __RXX move(last),
+                __RXX move(pred), __RXX move(proj));
+        }
+    }
+
+    template <input_range R, typename Proj = identity,
+        std::indirect_unary_predicate<std::projected<iterator_t<R>, Proj>> Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr borrowed_iterator_t<R> operator()(
+        R&& range, Pred pred, Proj proj = {}) RXX_CONST_CALL {
+        return find_if_t{}(ranges::begin(range), ranges::end(range),
+            __RXX move(pred), __RXX move(proj));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::find;
-using std::ranges::find_if;
+inline constexpr details::find_t find{};
+inline constexpr details::find_if_t find_if{};
 using std::ranges::find_if_not;
 } // namespace cpo
 } // namespace ranges
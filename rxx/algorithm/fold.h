@@ -4,7 +4,9 @@
 #include "rxx/config.h"
 
 #include "rxx/algorithm/return_types.h"
+#include "rxx/details/strided_scan.h"
 #include "rxx/iterator.h"
+#include "rxx/iterator/for_each_while.h"
 #include "rxx/optional/optional_nua.h"
 #include "rxx/ranges/access.h"
 #include "rxx/ranges/borrow_traits.h"
@@ -37,6 +39,16 @@ concept indirectly_binary_left_foldable = std::copy_constructible<F> &&
     indirectly_binary_left_foldable_impl<F, T, I,
         std::decay_t<std::invoke_result_t<F&, T, iter_reference_t<I>>>>;
 
+/** Integer sums of strided elements, which may be added in any order. */
+template <typename F, typename T, typename I, typename S>
+concept strided_integral_sum = strided_integral_range<I, S> &&
+    std::integral<std::remove_cvref_t<T>> &&
+    (std::same_as<std::remove_cvref_t<F>, std::plus<>> ||
+        std::same_as<std::remove_cvref_t<F>,
+            std::plus<std::remove_cvref_t<T>>>) &&
+    std::integral<
+        std::decay_t<std::invoke_result_t<F&, T, iter_reference_t<I>>>>;
+
 class fold_left_with_iter_t {
 protected:
     template <typename O, typename I, typename S, typename T, typename F>
@@ -45,15 +57,25 @@ protected:
         using SecondType =
             std::decay_t<std::invoke_result_t<F&, T, iter_reference_t<I>>>;
         using Result = fold_left_with_iter_result<O, SecondType>;
+        if constexpr (strided_integral_sum<F, T, I, S>) {
+            auto const size = last - first;
+            return Result{first + size,
+                details::strided_sum(
+                    first, size, static_cast<SecondType>(init))};
+        }
+
         if (first == last) {
             return Result{__RXX move(first), SecondType(__RXX move(init))};
         }
 
         SecondType accum = std::invoke(func, __RXX move(init), *first);
-
-        for (++first; first != last; ++first) {
-            accum = std::invoke(func, __RXX move(accum), *first);
-        }
+        ++first;
+        first = ranges::for_each_while(__RXX move(first), __RXX move(last),
+            [&]<typename U>(U&& element) {
+                accum = std::invoke(
+                    func, __RXX move(accum), __RXX forward<U>(element));
+                return true;
+            });
 
         return Result{__RXX move(first), __RXX move(accum)};
     }
@@ -110,9 +132,13 @@ protected:
         }
 
         __RXX nua::optional<SecondType> init(std::in_place, *first);
-        for (++first; first != last; ++first) {
-            *init = std::invoke(func, __RXX move(*init), *first);
-        }
+        ++first;
+        first = ranges::for_each_while(__RXX move(first), __RXX move(last),
+            [&]<typename U>(U&& element) {
+                *init = std::invoke(
+                    func, __RXX move(*init), __RXX forward<U>(element));
+                return true;
+            });
 
         return Result{__RXX move(first), __RXX move(init)};
     }
@@ -4,19 +4,60 @@
 #include "rxx/config.h"
 
 #include "rxx/algorithm/return_types.h"
+#include "rxx/functional/identity.h"
+#include "rxx/iterator/for_each_while.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
 
 #include <algorithm>
+#include <functional>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+template <typename I, typename F>
+using for_each_result = in_fun_result<I, F>;
+
+namespace details {
+struct for_each_t {
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity,
+        std::indirectly_unary_invocable<std::projected<I, Proj>> F>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr for_each_result<I, F>
+    operator()(I first, S last, F func, Proj proj = {}) RXX_CONST_CALL {
+        if constexpr (internally_iterable<I, S>) {
+            first = ranges::for_each_while(__RXX move(first), __RXX move(last),
+                [&]<typename T>(T&& element) {
+                    std::invoke(
+                        func, std::invoke(proj, __RXX forward<T>(element)));
+                    return true;
+                });
+            return {__RXX move(first), __RXX move(func)};
+        } else {
+            auto result = std::ranges::for_each(__RXX move(first),
+                __RXX move(last), __RXX move(func), __RXX move(proj));
+            return {__RXX move(result.in), __RXX move(result.fun)};
+        }
+    }
+
+    template <input_range R, typename Proj = identity,
+        std::indirectly_unary_invocable<std::projected<iterator_t<R>, Proj>> F>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr for_each_result<
+        borrowed_iterator_t<R>, F>
+    operator()(R&& range, F func, Proj proj = {}) RXX_CONST_CALL {
+        auto result = for_each_t{}(ranges::begin(range), ranges::end(range),
+            __RXX move(func), __RXX move(proj));
+        return {__RXX move(result.in), __RXX move(result.fun)};
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::for_each;
+inline constexpr details::for_each_t for_each{};
 using std::ranges::for_each_n;
 } // namespace cpo
 
-template <typename I, typename F>
-using for_each_result = in_fun_result<I, F>;
-
 } // namespace ranges
 RXX_DEFAULT_NAMESPACE_END
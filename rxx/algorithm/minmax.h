@@ -4,18 +4,77 @@
 #include "rxx/config.h"
 
 #include "rxx/algorithm/return_types.h"
+#include "rxx/details/strided_scan.h"
+#include "rxx/functional/identity.h"
+#include "rxx/functional/less.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/utility.h"
 
 #include <algorithm>
+#include <functional>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+namespace details {
+template <typename Comp, typename T>
+concept builtin_less_than = std::same_as<Comp, __RXX ranges::less> ||
+    std::same_as<Comp, std::ranges::less> || std::same_as<Comp, std::less<>> ||
+    std::same_as<Comp, std::less<T>>;
+
+/**
+ * Strided integers ordered by the builtin `<`, whose least or greatest
+ * element is searched for a block at a time.
+ */
+template <typename I, typename S, typename Comp, typename Proj>
+concept strided_integral_extremum = strided_integral_range<I, S> &&
+    std::same_as<Proj, identity> && builtin_less_than<Comp, iter_value_t<I>>;
+
+template <bool Greatest>
+struct extremum_element_t {
+    template <std::forward_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity,
+        std::indirect_strict_weak_order<std::projected<I, Proj>> Comp =
+            std::ranges::less>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, Comp comp = {}, Proj proj = {}) RXX_CONST_CALL {
+        if constexpr (strided_integral_extremum<I, S, Comp, Proj>) {
+            using Order = std::conditional_t<Greatest, std::greater<>,
+                std::less<>>;
+            auto const size = last - first;
+            return size == 0
+                ? first
+                : first + details::strided_extremum<Order>(first, size);
+        } else if constexpr (Greatest) {
+            return std::ranges::max_element(__RXX move(first),
+                __RXX move(last), __RXX move(comp), __RXX move(proj));
+        } else {
+            return std::ranges::min_element(__RXX move(first),
+                __RXX move(last), __RXX move(comp), __RXX move(proj));
+        }
+    }
+
+    template <forward_range R, typename Proj = identity,
+        std::indirect_strict_weak_order<std::projected<iterator_t<R>, Proj>>
+            Comp = std::ranges::less>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr borrowed_iterator_t<R> operator()(
+        R&& range, Comp comp = {}, Proj proj = {}) RXX_CONST_CALL {
+        return extremum_element_t{}(ranges::begin(range), ranges::end(range),
+            __RXX move(comp), __RXX move(proj));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
 using std::ranges::clamp;
 using std::ranges::max;
-using std::ranges::max_element;
+inline constexpr details::extremum_element_t<true> max_element{};
 using std::ranges::min;
-using std::ranges::min_element;
+inline constexpr details::extremum_element_t<false> min_element{};
 using std::ranges::minmax;
 using std::ranges::minmax_element;
 } // namespace cpo
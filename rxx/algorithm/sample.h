@@ -3,13 +3,128 @@
 
 #include "rxx/config.h"
 
-#include <algorithm>
+#include "rxx/details/bounded_random.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+
+#include <concepts>
+#include <cstdint>
+#include <random>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
+namespace details {
+struct sample_t {
+private:
+    /**
+     * Selection sampling (Knuth's Algorithm S), preserves the relative order
+     * of the selected elements. Each element is kept with probability
+     * `needed / size`; the decisions for consecutive elements are drawn in
+     * batches from a single 64-bit word.
+     */
+    template <typename I, typename O, typename Words>
+    __RXX_HIDE_FROM_ABI static constexpr O select(I first, O out,
+        uint64_t size, uint64_t needed, Words& words) {
+        bounded_countdown draws(words, size);
+        for (; needed; ++first) {
+            if (draws() < needed) {
+                *out = *first;
+                ++out;
+                --needed;
+            }
+        }
+
+        return out;
+    }
+
+    /**
+     * Reservoir sampling (Algorithm R) for single-pass inputs. The element at
+     * position `i` replaces a random slot of the reservoir with probability
+     * `n / (i + 1)`; the replacement slots for consecutive elements are drawn
+     * in batches from a single 64-bit word.
+     */
+    template <typename I, typename S, typename O, typename Words>
+    __RXX_HIDE_FROM_ABI static constexpr O reservoir(
+        I first, S last, O out, uint64_t reservoir_size, Words& words) {
+        using D = iter_difference_t<O>;
+        uint64_t seen = 0;
+        for (; seen != reservoir_size; ++seen, ++first) {
+            if (first == last) {
+                return out + D(seen);
+            }
+            out[D(seen)] = *first;
+        }
+
+        uint64_t bounds[bounded_batch_max];
+        uint64_t indices[bounded_batch_max];
+        while (first != last) {
+            size_t const count = bounded_batch_size(seen + bounded_batch_max);
+            uint64_t product = 1;
+            for (size_t idx = 0; idx != count; ++idx) {
+                bounds[idx] = seen + idx + 1;
+                product *= bounds[idx];
+            }
+
+            // The bounds grow, so the exact product is always provided
+            words.bounded_batch(bounds, indices, count, product);
+            for (size_t idx = 0; idx != count && first != last;
+                 ++idx, ++first, ++seen) {
+                if (indices[idx] < reservoir_size) {
+                    out[D(indices[idx])] = *first;
+                }
+            }
+        }
+
+        return out + D(reservoir_size);
+    }
+
+    template <typename I, typename S, typename O, typename G>
+    __RXX_HIDE_FROM_ABI static constexpr O impl(I first, S last, O out,
+        iter_difference_t<I> count, G& gen, auto get_size) {
+        if (count <= 0) {
+            return out;
+        }
+
+        random_words<G> words(gen);
+        if constexpr (std::forward_iterator<I>) {
+            auto const size = static_cast<uint64_t>(get_size());
+            auto const needed = static_cast<uint64_t>(count);
+            return select(__RXX move(first), __RXX move(out), size,
+                needed < size ? needed : size, words);
+        } else {
+            return reservoir(__RXX move(first), __RXX move(last),
+                __RXX move(out), static_cast<uint64_t>(count), words);
+        }
+    }
+
+public:
+    template <std::input_iterator I, std::sentinel_for<I> S,
+        std::weakly_incrementable O, typename G>
+    requires (std::forward_iterator<I> || std::random_access_iterator<O>) &&
+        std::indirectly_copyable<I, O> &&
+        std::uniform_random_bit_generator<std::remove_reference_t<G>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr O operator()(I first, S last,
+        O out, iter_difference_t<I> count, G&& gen) RXX_CONST_CALL {
+        return impl(first, last, __RXX move(out), count, gen,
+            [&]() { return ranges::distance(first, last); });
+    }
+
+    template <input_range R, std::weakly_incrementable O, typename G>
+    requires (forward_range<R> || std::random_access_iterator<O>) &&
+        std::indirectly_copyable<iterator_t<R>, O> &&
+        std::uniform_random_bit_generator<std::remove_reference_t<G>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr O operator()(R&& range,
+        O out, range_difference_t<R> count, G&& gen) RXX_CONST_CALL {
+        return impl(ranges::begin(range), ranges::end(range), __RXX move(out),
+            count, gen, [&]() { return ranges::distance(range); });
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-using std::ranges::sample;
+inline constexpr details::sample_t sample{};
 }
 
 } // namespace ranges
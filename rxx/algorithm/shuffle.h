@@ -0,0 +1,135 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/bounded_random.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+namespace ranges {
+
+namespace details {
+
+/**
+ * Contiguous inputs occupying more than this many bytes no longer fit in a
+ * typical L2 cache, so almost every Fisher-Yates swap misses. Beyond it, swap
+ * targets are drawn ahead of time and prefetched.
+ */
+inline constexpr size_t shuffle_prefetch_threshold = size_t(1) << 18;
+
+/**
+ * Number of swap targets drawn ahead of the one being swapped when
+ * prefetching, enough outstanding misses to cover DRAM latency.
+ */
+inline constexpr size_t shuffle_prefetch_distance = 32;
+
+struct shuffle_t {
+private:
+    /**
+     * Fisher-Yates from the back, drawing up to `bounded_batch_max` swap
+     * targets from each 64-bit word.
+     */
+    template <typename I, typename Words>
+    __RXX_HIDE_FROM_ABI static constexpr void fisher_yates(
+        I first, uint64_t size, Words& words) {
+        using D = iter_difference_t<I>;
+        if (size < 2) {
+            return;
+        }
+
+        bounded_countdown targets(words, size);
+        for (uint64_t last = size - 1; last != 0; --last) {
+            ranges::iter_swap(first + D(last), first + D(targets()));
+        }
+    }
+
+    /**
+     * Fisher-Yates for large contiguous inputs. The swap targets only depend
+     * on the generator, so they are drawn `shuffle_prefetch_distance` steps
+     * ahead and prefetched, keeping many cache misses in flight instead of
+     * stalling on each one in turn.
+     */
+    template <typename I, typename Words>
+    __RXX_HIDE_FROM_ABI static void fisher_yates_prefetch(
+        I first, uint64_t size, Words& words) {
+        using D = iter_difference_t<I>;
+        constexpr size_t distance = shuffle_prefetch_distance;
+        auto const data = std::to_address(first);
+        bounded_countdown targets(words, size);
+        uint64_t pending[distance];
+        uint64_t const steps = size - 1;
+        for (size_t idx = 0; idx != distance; ++idx) {
+            pending[idx] = targets();
+            RXX_BUILTIN_prefetch(data + pending[idx], 1);
+        }
+
+        uint64_t step = 0;
+        for (; step + distance != steps; ++step) {
+            uint64_t& slot = pending[step % distance];
+            uint64_t const target = slot;
+            slot = targets();
+            RXX_BUILTIN_prefetch(data + slot, 1);
+            ranges::iter_swap(first + D(steps - step), first + D(target));
+        }
+
+        for (; step != steps; ++step) {
+            ranges::iter_swap(first + D(steps - step),
+                first + D(pending[step % distance]));
+        }
+    }
+
+    template <typename I, typename G>
+    __RXX_HIDE_FROM_ABI static constexpr void impl(
+        I first, uint64_t size, G& gen) {
+        random_words<G> words(gen);
+        if constexpr (std::contiguous_iterator<I>) {
+            constexpr size_t element_size = sizeof(iter_value_t<I>);
+            if (!std::is_constant_evaluated() &&
+                size > shuffle_prefetch_distance &&
+                size * element_size > shuffle_prefetch_threshold) {
+                fisher_yates_prefetch(first, size, words);
+                return;
+            }
+        }
+
+        fisher_yates(first, size, words);
+    }
+
+public:
+    template <std::random_access_iterator I, std::sentinel_for<I> S,
+        typename G>
+    requires std::permutable<I> &&
+        std::uniform_random_bit_generator<std::remove_reference_t<G>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, G&& gen) RXX_CONST_CALL {
+        auto const end = ranges::next(first, last);
+        impl(first, static_cast<uint64_t>(end - first), gen);
+        return end;
+    }
+
+    template <random_access_range R, typename G>
+    requires std::permutable<iterator_t<R>> &&
+        std::uniform_random_bit_generator<std::remove_reference_t<G>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr borrowed_iterator_t<R>
+    operator()(R&& range, G&& gen) RXX_CONST_CALL {
+        return operator()(ranges::begin(range), ranges::end(range), gen);
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::shuffle_t shuffle{};
+} // namespace cpo
+
+} // namespace ranges
+RXX_DEFAULT_NAMESPACE_END
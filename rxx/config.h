@@ -14,6 +14,7 @@
 #include "rxx/configuration/compiler_barrier.h"
 #include "rxx/configuration/exceptions.h"
 #include "rxx/configuration/keywords.h"
+#include "rxx/configuration/memchr.h"
 #include "rxx/configuration/memcmp.h"
 #include "rxx/configuration/memcpy.h"
 #include "rxx/configuration/modules.h"
@@ -41,6 +42,14 @@
 #  define RXX_ENABLE_STD_INTEROP 0
 #endif
 
+/**
+ * Execution policy overloads are opt-in as including <execution> requires
+ * linking against the parallel backend on some standard libraries.
+ */
+#ifndef RXX_ENABLE_EXECUTION_POLICY
+#  define RXX_ENABLE_EXECUTION_POLICY 0
+#endif
+
 #define RXX_DEFAULT_NAMESPACE_BEGIN RXX_NAMESPACE_BEGIN(RXX_NS)
 
 #define RXX_DEFAULT_NAMESPACE_END RXX_NAMESPACE_END(RXX_NS)
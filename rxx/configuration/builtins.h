@@ -56,6 +56,14 @@ void abort(void);
 #  define RXX_BUILTIN_unreachable() abort()
 #endif /* RXX_HAS_BUILTIN(__builtin_unreachable) */
 
+#if RXX_HAS_BUILTIN(__builtin_prefetch)
+#  define RXX_BUILTIN_prefetch(...) __builtin_prefetch(__VA_ARGS__)
+#elif RXX_COMPILER_GCC_AT_LEAST(3, 1, 0)
+#  define RXX_BUILTIN_prefetch(...) __builtin_prefetch(__VA_ARGS__)
+#else /* RXX_HAS_BUILTIN(__builtin_prefetch) */
+#  define RXX_BUILTIN_prefetch(...) (void)0
+#endif /* RXX_HAS_BUILTIN(__builtin_prefetch) */
+
 #if RXX_HAS_BUILTIN(__builtin_is_constant_evaluated)
 #  define RXX_BUILTIN_is_constant_evaluated() __builtin_is_constant_evaluated()
 #endif /* RXX_HAS_BUILTIN(__builtin_is_constant_evaluated) */
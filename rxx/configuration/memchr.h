@@ -0,0 +1,23 @@
+/* Copyright 2023-2025 Bryan Wong */
+
+#pragma once
+
+#include "rxx/configuration/builtin_check.h"
+
+#if RXX_HAS_BUILTIN(__builtin_memchr)
+
+#  define __RXX_MEMCHR __builtin_memchr
+
+#else
+
+#  include "rxx/configuration/compiler.h"
+
+/* C++ overloads memchr on constness, so take the library's declarations */
+#  include <string.h>
+
+#  if RXX_COMPILER_MSVC
+#    pragma intrinsic(memchr)
+#  endif
+#  define __RXX_MEMCHR ::memchr
+
+#endif
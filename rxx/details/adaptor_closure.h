@@ -5,6 +5,7 @@
 
 #include "rxx/functional/bind_back.h"
 #include "rxx/utility/forward.h"
+#include "rxx/utility/move.h"
 
 #include <ranges> // IWYU pragma: keep
 #include <type_traits>
@@ -322,6 +323,57 @@ using adaptor_non_closure = adaptor_non_closure_type<Cpo>;
 #  error "Unsupported standard library"
 #endif
 
+/**
+ * The closure of the adaptor `Cpo` applied to a single function object.
+ * Composing two closures of the same adaptor yields the one closure returned
+ * by `Cpo::fuse`, if it provides one, so the pipeline builds a single view
+ * where it would otherwise nest two.
+ */
+template <typename Cpo, typename F>
+struct fusable_closure : public adaptor_closure<fusable_closure<Cpo, F>> {
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) F func;
+
+    template <typename U>
+    requires std::constructible_from<F, U>
+    __RXX_HIDE_FROM_ABI explicit constexpr fusable_closure(U&& arg) noexcept(
+        std::is_nothrow_constructible_v<F, U>)
+        : func(__RXX forward<U>(arg)) {}
+
+    template <typename Range>
+    requires std::invocable<Cpo const&, Range, F const&>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto operator()(Range&& range) const& noexcept(
+        std::is_nothrow_invocable_v<Cpo const&, Range, F const&>) {
+        return Cpo{}(__RXX forward<Range>(range), func);
+    }
+
+    template <typename Range>
+    requires std::invocable<Cpo const&, Range, F>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto operator()(Range&& range) && noexcept(
+        std::is_nothrow_invocable_v<Cpo const&, Range, F>) {
+        return Cpo{}(__RXX forward<Range>(range), __RXX move(func));
+    }
+
+    template <typename Range>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto operator()(Range&&) const&& = delete;
+
+    /**
+     * More specialized than the generic composition of two closures, so it
+     * is picked over it whenever `Cpo` can fuse the two functions.
+     */
+    template <typename G>
+    requires requires(F&& first, G&& second) {
+        Cpo::fuse(__RXX move(first), __RXX move(second));
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto operator|(
+        fusable_closure lhs, fusable_closure<Cpo, G> rhs) {
+        return Cpo::fuse(__RXX move(lhs.func), __RXX move(rhs.func));
+    }
+};
+
 } // namespace ranges::details
 
 RXX_DEFAULT_NAMESPACE_END
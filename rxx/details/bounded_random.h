@@ -0,0 +1,220 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/random/generate_random.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges::details {
+
+/**
+ * Returns the high half of the 128-bit product of `left` and `right`, the
+ * low half is written to `low`.
+ */
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, ALWAYS_INLINE)
+constexpr uint64_t mul_wide(
+    uint64_t left, uint64_t right, uint64_t& low) noexcept {
+#if RXX_SUPPORTS_INT128
+    __uint128_t const product = __uint128_t(left) * right;
+    low = static_cast<uint64_t>(product);
+    return static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t const ll = uint64_t(uint32_t(left)) * uint32_t(right);
+    uint64_t const lh = uint64_t(uint32_t(left)) * (right >> 32);
+    uint64_t const hl = (left >> 32) * uint64_t(uint32_t(right));
+    uint64_t const hh = (left >> 32) * (right >> 32);
+    uint64_t const mid = (ll >> 32) + uint32_t(lh) + uint32_t(hl);
+    low = (mid << 32) | uint32_t(ll);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/**
+ * Adapts a uniform random bit generator into a source of uniformly
+ * distributed 64-bit words.
+ *
+ * Engines with a bulk `generate_random` member are drawn from in blocks
+ * through `ranges::generate_random`, so any values left in the block when
+ * the source is destroyed are lost to the caller. Other engines are invoked
+ * only as often as needed.
+ */
+template <typename G>
+class random_words {
+    using result_type = std::invoke_result_t<G&>;
+    static constexpr auto engine_min = std::remove_cvref_t<G>::min();
+    static constexpr auto engine_max = std::remove_cvref_t<G>::max();
+    static constexpr bool full_64 =
+        engine_min == 0 && engine_max == std::numeric_limits<uint64_t>::max();
+    static constexpr bool full_32 =
+        engine_min == 0 && engine_max == std::numeric_limits<uint32_t>::max();
+    static constexpr size_t per_word = full_64 ? 1 : 2;
+    static constexpr bool buffered = (full_64 || full_32) &&
+        requires(G& gen, std::span<result_type> out) {
+            gen.generate_random(out);
+        };
+    static constexpr size_t buffer_size =
+        buffered ? generate_random_block : 1;
+
+public:
+    __RXX_HIDE_FROM_ABI explicit constexpr random_words(G& gen) noexcept
+        : gen_(RXX_BUILTIN_addressof(gen)) {}
+
+    __RXX_HIDE_FROM_ABI constexpr uint64_t operator()() {
+        if constexpr (buffered) {
+            if (position_ == buffer_size) {
+                ranges::generate_random(
+                    std::span<result_type>(buffer_), *gen_);
+                position_ = 0;
+            }
+            uint64_t word = static_cast<uint64_t>(buffer_[position_++]);
+            if constexpr (per_word == 2) {
+                word |= static_cast<uint64_t>(buffer_[position_++]) << 32;
+            }
+            return word;
+        } else if constexpr (full_64) {
+            return static_cast<uint64_t>((*gen_)());
+        } else if constexpr (full_32) {
+            uint64_t const low = static_cast<uint64_t>((*gen_)());
+            return low | (static_cast<uint64_t>((*gen_)()) << 32);
+        } else {
+            return std::uniform_int_distribution<uint64_t>{}(*gen_);
+        }
+    }
+
+    /**
+     * Returns a uniformly distributed integer in [0, bound) using Lemire's
+     * nearly divisionless method.
+     */
+    __RXX_HIDE_FROM_ABI constexpr uint64_t bounded(uint64_t bound) {
+        uint64_t low;
+        uint64_t high = mul_wide((*this)(), bound, low);
+        if (low < bound) {
+            uint64_t const threshold = (0 - bound) % bound;
+            while (low < threshold) {
+                high = mul_wide((*this)(), bound, low);
+            }
+        }
+        return high;
+    }
+
+    /**
+     * Draws `count` integers at once, the i-th uniformly distributed in
+     * [0, bounds[i]), from a single 64-bit word in the common case (batched
+     * Lemire). The product of the bounds must not exceed 2^64 and
+     * `product_hint` must be no smaller than that product; it is updated to
+     * the exact product whenever it had to be computed.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void bounded_batch(uint64_t const* bounds,
+        uint64_t* out, size_t count, uint64_t& product_hint) {
+        uint64_t low = (*this)();
+        for (size_t idx = 0; idx != count; ++idx) {
+            out[idx] = mul_wide(low, bounds[idx], low);
+        }
+
+        if (low < product_hint) {
+            uint64_t product = bounds[0];
+            for (size_t idx = 1; idx != count; ++idx) {
+                product *= bounds[idx];
+            }
+            product_hint = product;
+            uint64_t const threshold = (0 - product) % product;
+            while (low < threshold) {
+                low = (*this)();
+                for (size_t idx = 0; idx != count; ++idx) {
+                    out[idx] = mul_wide(low, bounds[idx], low);
+                }
+            }
+        }
+    }
+
+private:
+    std::remove_reference_t<G>* gen_;
+    result_type buffer_[buffer_size]{};
+    size_t position_ = buffer_size;
+};
+
+/**
+ * Number of indices drawn per 64-bit word when the largest bound is `bound`,
+ * keeping the product of the bounds well below 2^64 so rejections stay rare.
+ */
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+constexpr size_t bounded_batch_size(uint64_t bound) noexcept {
+    if (bound <= (uint64_t(1) << 9)) {
+        return 6;
+    } else if (bound <= (uint64_t(1) << 11)) {
+        return 5;
+    } else if (bound <= (uint64_t(1) << 14)) {
+        return 4;
+    } else if (bound <= (uint64_t(1) << 19)) {
+        return 3;
+    } else if (bound <= (uint64_t(1) << 30)) {
+        return 2;
+    }
+    return 1;
+}
+
+inline constexpr size_t bounded_batch_max = 6;
+
+/**
+ * Produces the sequence x_0, x_1, ... where x_i is uniformly distributed in
+ * [0, start - i), as needed by Fisher-Yates and selection sampling. Values are
+ * drawn in batches with `random_words::bounded_batch`; at most `start` values
+ * may be requested.
+ */
+template <typename Words>
+class bounded_countdown {
+public:
+    __RXX_HIDE_FROM_ABI constexpr bounded_countdown(
+        Words& words, uint64_t start) noexcept
+        : words_(RXX_BUILTIN_addressof(words))
+        , next_bound_(start) {}
+
+    __RXX_HIDE_FROM_ABI constexpr uint64_t operator()() {
+        if (position_ == count_) {
+            refill();
+        }
+        return indices_[position_++];
+    }
+
+private:
+    __RXX_HIDE_FROM_ABI constexpr void refill() {
+        size_t count = bounded_batch_size(next_bound_);
+        if (count > next_bound_) {
+            count = static_cast<size_t>(next_bound_);
+        }
+
+        if (count != count_) {
+            // The previous product no longer bounds the new one
+            product_hint_ = std::numeric_limits<uint64_t>::max();
+        }
+
+        uint64_t bounds[bounded_batch_max]{};
+        for (size_t idx = 0; idx != count; ++idx) {
+            bounds[idx] = next_bound_ - idx;
+        }
+
+        words_->bounded_batch(bounds, indices_, count, product_hint_);
+        next_bound_ -= count;
+        count_ = count;
+        position_ = 0;
+    }
+
+    Words* words_;
+    uint64_t next_bound_;
+    uint64_t product_hint_ = 0;
+    uint64_t indices_[bounded_batch_max]{};
+    size_t count_ = 0;
+    size_t position_ = 0;
+};
+
+} // namespace ranges::details
+
+RXX_DEFAULT_NAMESPACE_END
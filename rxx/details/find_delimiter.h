@@ -0,0 +1,57 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+
+/** Single byte elements whose equality is equality of their bytes. */
+template <typename T>
+concept byte_like = !std::is_volatile_v<T> &&
+    (std::same_as<std::remove_const_t<T>, char> ||
+        std::same_as<std::remove_const_t<T>, signed char> ||
+        std::same_as<std::remove_const_t<T>, unsigned char> ||
+#if RXX_SUPPORTS_CHAR8_T
+        std::same_as<std::remove_const_t<T>, char8_t> ||
+#endif
+        std::same_as<std::remove_const_t<T>, std::byte>);
+
+/**
+ * Returns the first position in [first, last) equal to `value`, or `last`.
+ * Outside of constant evaluation this is a single memchr call.
+ */
+template <byte_like T>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+constexpr T const* find_delimiter(
+    T const* first, T const* last, T const value) noexcept {
+    if (!std::is_constant_evaluated()) {
+        if (first == last) {
+            return last;
+        }
+
+        auto const size = static_cast<size_t>(last - first);
+        auto const* const found =
+            __RXX_MEMCHR(first, static_cast<unsigned char>(value), size);
+        return found ? static_cast<T const*>(found) : last;
+    }
+
+    while (first != last && *first != value) {
+        ++first;
+    }
+
+    return first;
+}
+
+} // namespace details
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
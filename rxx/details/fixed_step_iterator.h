@@ -0,0 +1,153 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges::details {
+
+/**
+ * Random access iterator over contiguous storage that moves `Step`
+ * elements at a time, a compile time constant, and yields either the
+ * element it is on (`Extent == 0`) or the `std::span<T, Extent>` starting
+ * there. It is kept as the start of the storage and an index so that no
+ * pointer is formed past the end of it.
+ */
+template <typename T, size_t Step, size_t Extent>
+class fixed_step_iterator {
+    static_assert(Step > 0, "The step must be positive");
+    static constexpr bool yields_span = Extent != 0;
+
+public:
+    using reference =
+        std::conditional_t<yields_span, std::span<T, Extent>, T&>;
+    using value_type =
+        std::conditional_t<yields_span, reference, std::remove_cv_t<T>>;
+    using difference_type = ptrdiff_t;
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::conditional_t<yields_span,
+        std::input_iterator_tag, std::random_access_iterator_tag>;
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator() noexcept = default;
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator(
+        T* data, difference_type index) noexcept
+        : data_(data)
+        , index_(index) {}
+
+    template <typename U>
+    requires std::is_convertible_v<U (*)[], T (*)[]>
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator(
+        fixed_step_iterator<U, Step, Extent> other) noexcept
+        : data_(other.data_)
+        , index_(other.index_) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr reference operator*() const noexcept {
+        auto const current = data_ + index_ * difference_type(Step);
+        if constexpr (yields_span) {
+            return reference(current, Extent);
+        } else {
+            return *current;
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr reference operator[](difference_type offset) const noexcept {
+        return *(*this + offset);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator operator++(
+        int) noexcept {
+        auto previous = *this;
+        ++index_;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator& operator--() noexcept {
+        --index_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator operator--(
+        int) noexcept {
+        auto previous = *this;
+        --index_;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator& operator+=(
+        difference_type offset) noexcept {
+        index_ += offset;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_iterator& operator-=(
+        difference_type offset) noexcept {
+        index_ -= offset;
+        return *this;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr fixed_step_iterator operator+(
+        fixed_step_iterator iter, difference_type offset) noexcept {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr fixed_step_iterator operator+(
+        difference_type offset, fixed_step_iterator iter) noexcept {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr fixed_step_iterator operator-(
+        fixed_step_iterator iter, difference_type offset) noexcept {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(fixed_step_iterator const& left,
+        fixed_step_iterator const& right) noexcept {
+        return left.index_ - right.index_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(fixed_step_iterator const& left,
+        fixed_step_iterator const& right) noexcept {
+        return left.index_ == right.index_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr std::strong_ordering operator<=>(
+        fixed_step_iterator const& left,
+        fixed_step_iterator const& right) noexcept {
+        return left.index_ <=> right.index_;
+    }
+
+private:
+    template <typename, size_t, size_t>
+    friend class fixed_step_iterator;
+
+    T* data_ = nullptr;
+    difference_type index_ = 0;
+};
+
+} // namespace ranges::details
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,16 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges::details {
+template <typename T>
+concept has_arrow = std::is_pointer_v<T> ||
+    (std::is_class_v<T> && requires(T val) { val.operator->(); });
+} // namespace ranges::details
+
+RXX_DEFAULT_NAMESPACE_END
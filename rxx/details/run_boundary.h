@@ -0,0 +1,117 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/functional/equal_to.h"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+
+template <typename Pred, typename T>
+inline constexpr bool is_equality_predicate =
+    std::same_as<Pred, __RXX ranges::equal_to> ||
+    std::same_as<Pred, std::ranges::equal_to> ||
+    std::same_as<Pred, std::equal_to<>> ||
+    std::same_as<Pred, std::equal_to<T>>;
+
+/**
+ * Elements compared with the builtin `==`, for which a run of equal
+ * elements is a run of elements equal to its first one.
+ */
+template <typename T>
+concept run_scalar = !std::is_volatile_v<T> &&
+    (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>);
+
+/** Elements compared per block, sized to a vector register. */
+template <typename T>
+inline constexpr size_t run_block_size = sizeof(T) >= 16 ? 2 : 32 / sizeof(T);
+
+/**
+ * Returns the first position in [first, last) not equal to `value`.
+ *
+ * The first block is probed one element at a time so short runs stay
+ * cheap. Past it, whole blocks are compared without an early exit and the
+ * mismatches counted rather than or'ed, which is the form compilers
+ * vectorize; the mismatch is then located within its block.
+ */
+template <run_scalar T>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+constexpr T const* find_run_end(
+    T const* first, T const* last, T const value) noexcept {
+    constexpr size_t block = run_block_size<T>;
+    for (size_t idx = 0; idx != block; ++idx, ++first) {
+        if (first == last || *first != value) {
+            return first;
+        }
+    }
+
+    while (static_cast<size_t>(last - first) >= block) {
+        size_t mismatches = 0;
+        for (size_t idx = 0; idx != block; ++idx) {
+            mismatches += first[idx] != value;
+        }
+
+        if (mismatches != 0) {
+            break;
+        }
+
+        first += block;
+    }
+
+    while (first != last && *first == value) {
+        ++first;
+    }
+
+    return first;
+}
+
+/**
+ * Returns the start of the run in [first, last) equal to `value` which
+ * ends at `last`, scanning backwards the same way as `find_run_end`.
+ */
+template <run_scalar T>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+constexpr T const* find_run_start(
+    T const* first, T const* last, T const value) noexcept {
+    constexpr size_t block = run_block_size<T>;
+    for (size_t idx = 0; idx != block; ++idx, --last) {
+        if (last == first || last[-1] != value) {
+            return last;
+        }
+    }
+
+    while (static_cast<size_t>(last - first) >= block) {
+        T const* const start = last - block;
+        size_t mismatches = 0;
+        for (size_t idx = 0; idx != block; ++idx) {
+            mismatches += start[idx] != value;
+        }
+
+        if (mismatches != 0) {
+            break;
+        }
+
+        last = start;
+    }
+
+    while (last != first && last[-1] == value) {
+        --last;
+    }
+
+    return last;
+}
+
+} // namespace details
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,47 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+
+/**
+ * The size shared by every range of type `R`, when the type alone fixes it:
+ * builtin arrays, `std::array`, fixed extent spans and ranges with a static
+ * constexpr `size()` such as `single_view`.
+ */
+template <typename R>
+inline constexpr size_t static_range_size = size_t(-1);
+
+template <typename T, size_t N>
+inline constexpr size_t static_range_size<T[N]> = N;
+
+template <typename T, size_t N>
+inline constexpr size_t static_range_size<std::array<T, N>> = N;
+
+template <typename T, size_t N>
+requires (N != std::dynamic_extent)
+inline constexpr size_t static_range_size<std::span<T, N>> = N;
+
+template <typename R>
+requires requires { std::integral_constant<size_t, R::size()>{}; }
+inline constexpr size_t static_range_size<R> = R::size();
+
+template <typename R>
+concept has_static_range_size =
+    static_range_size<std::remove_cvref_t<R>> != size_t(-1);
+
+} // namespace details
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,148 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges::details {
+
+/**
+ * Random access iterator over objects of type `T` laid out `Stride` bytes
+ * apart, such as one member of each element of an array of structs. It is
+ * a byte pointer with the stride in its type, so algorithms can see the
+ * layout and scan it directly instead of going through a projection.
+ */
+template <typename T, ptrdiff_t Stride>
+class strided_pointer {
+    static_assert(Stride > 0, "The stride must be positive");
+    static_assert(!std::is_volatile_v<T>, "Volatile objects are unsupported");
+    using byte_type RXX_NODEBUG = std::conditional_t<std::is_const_v<T>,
+        unsigned char const, unsigned char>;
+
+public:
+    using value_type = std::remove_cv_t<T>;
+    using reference = T&;
+    using difference_type = ptrdiff_t;
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer() noexcept = default;
+
+    __RXX_HIDE_FROM_ABI explicit strided_pointer(T* object) noexcept
+        : bytes_(reinterpret_cast<byte_type*>(object)) {}
+
+    template <typename U>
+    requires std::is_convertible_v<U (*)[], T (*)[]>
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer(
+        strided_pointer<U, Stride> other) noexcept
+        : bytes_(other.bytes_) {}
+
+    /** The distance in bytes between consecutive objects. */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr difference_type stride() noexcept { return Stride; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    T* operator->() const noexcept { return reinterpret_cast<T*>(bytes_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    T& operator*() const noexcept { return *reinterpret_cast<T*>(bytes_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    T& operator[](difference_type offset) const noexcept {
+        return *reinterpret_cast<T*>(bytes_ + offset * Stride);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer& operator++() noexcept {
+        bytes_ += Stride;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer operator++(int) noexcept {
+        auto previous = *this;
+        bytes_ += Stride;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer& operator--() noexcept {
+        bytes_ -= Stride;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer operator--(int) noexcept {
+        auto previous = *this;
+        bytes_ -= Stride;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer& operator+=(
+        difference_type offset) noexcept {
+        bytes_ += offset * Stride;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr strided_pointer& operator-=(
+        difference_type offset) noexcept {
+        bytes_ -= offset * Stride;
+        return *this;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr strided_pointer operator+(
+        strided_pointer iter, difference_type offset) noexcept {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr strided_pointer operator+(
+        difference_type offset, strided_pointer iter) noexcept {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr strided_pointer operator-(
+        strided_pointer iter, difference_type offset) noexcept {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        strided_pointer const& left, strided_pointer const& right) noexcept {
+        return (left.bytes_ - right.bytes_) / Stride;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        strided_pointer const& left, strided_pointer const& right) noexcept {
+        return left.bytes_ == right.bytes_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr std::strong_ordering operator<=>(
+        strided_pointer const& left, strided_pointer const& right) noexcept {
+        return left.bytes_ <=> right.bytes_;
+    }
+
+private:
+    template <typename, ptrdiff_t>
+    friend class strided_pointer;
+
+    byte_type* bytes_ = nullptr;
+};
+
+template <typename I>
+inline constexpr bool is_strided_pointer = false;
+template <typename T, ptrdiff_t Stride>
+inline constexpr bool is_strided_pointer<strided_pointer<T, Stride>> = true;
+
+} // namespace ranges::details
+
+RXX_DEFAULT_NAMESPACE_END
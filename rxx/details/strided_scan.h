@@ -0,0 +1,125 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/run_boundary.h"
+#include "rxx/details/strided_pointer.h"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+
+/**
+ * [I, S) is a run of scalars laid out at a fixed stride, which the
+ * `strided_*` scans below read as counted loops over a byte pointer rather
+ * than through an iterator and a projection.
+ */
+template <typename I, typename S>
+concept strided_scalar_range = is_strided_pointer<I> && std::same_as<I, S> &&
+    run_scalar<std::iter_value_t<I>>;
+
+template <typename I, typename S>
+concept strided_integral_range = strided_scalar_range<I, S> &&
+    std::integral<std::iter_value_t<I>>;
+
+/** Returns the offset of the first of the `size` elements equal to `value`. */
+template <typename T, ptrdiff_t Stride>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+ptrdiff_t strided_find(strided_pointer<T, Stride> first, ptrdiff_t size,
+    std::remove_cv_t<T> const value) noexcept {
+    auto const last = first + size;
+    auto current = first;
+    for (; current != last && *current != value; ++current) {}
+    return current - first;
+}
+
+template <typename T, ptrdiff_t Stride>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+ptrdiff_t strided_count(strided_pointer<T, Stride> first, ptrdiff_t size,
+    std::remove_cv_t<T> const value) noexcept {
+    ptrdiff_t result = 0;
+    for (ptrdiff_t idx = 0; idx < size; ++idx) {
+        result += first[idx] == value;
+    }
+
+    return result;
+}
+
+/**
+ * Adds the `size` elements to `init` in unsigned arithmetic, which wraps
+ * the same as the signed sum would overflow, so the loop may be reordered.
+ */
+template <std::integral R, typename T, ptrdiff_t Stride>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+R strided_sum(
+    strided_pointer<T, Stride> first, ptrdiff_t size, R init) noexcept {
+    using U = std::make_unsigned_t<R>;
+    auto result = static_cast<U>(init);
+    for (ptrdiff_t idx = 0; idx < size; ++idx) {
+        result += static_cast<U>(static_cast<R>(first[idx]));
+    }
+
+    return static_cast<R>(result);
+}
+
+/**
+ * Returns the offset of the first element no other one of the `size`
+ * elements is `Compare`-before, i.e. the first least element for
+ * `std::less` and the first greatest for `std::greater`. `size` must be
+ * positive.
+ *
+ * The best value of each block is found by a loop of constant length with
+ * no branches, which compilers vectorize, and the block is only searched
+ * for its position when that value improves on the best one so far.
+ */
+template <typename Compare, typename T, ptrdiff_t Stride>
+RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+ptrdiff_t strided_extremum(
+    strided_pointer<T, Stride> first, ptrdiff_t size) noexcept {
+    constexpr ptrdiff_t block = run_block_size<std::remove_cv_t<T>>;
+    constexpr Compare before{};
+    ptrdiff_t result = 0;
+    auto best = *first;
+    ptrdiff_t offset = 1;
+    ++first;
+    for (; size - offset >= block; offset += block, first += block) {
+        auto candidate = first[0];
+        for (ptrdiff_t idx = 1; idx != block; ++idx) {
+            auto const value = first[idx];
+            candidate = before(value, candidate) ? value : candidate;
+        }
+
+        if (before(candidate, best)) {
+            ptrdiff_t idx = 0;
+            while (first[idx] != candidate) {
+                ++idx;
+            }
+
+            best = candidate;
+            result = offset + idx;
+        }
+    }
+
+    for (; offset < size; ++offset, ++first) {
+        if (before(*first, best)) {
+            best = *first;
+            result = offset;
+        }
+    }
+
+    return result;
+}
+
+} // namespace details
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
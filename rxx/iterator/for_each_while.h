@@ -0,0 +1,92 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/class_or_enum.h"
+#include "rxx/iterator/iter_traits.h"
+#include "rxx/iterator/segmented_iterator.h"
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+namespace details {
+template <typename I, typename S, typename F>
+void for_each_while(I, S, F) = delete;
+
+template <typename I, typename S, typename F>
+concept unqualified_for_each_while = class_or_enum<I> &&
+    requires(I first, S last, F sink) {
+        {
+            for_each_while(__RXX move(first), __RXX move(last), sink)
+        } -> std::same_as<I>;
+    };
+
+/** Sink used to detect iterators that customize `for_each_while`. */
+struct element_probe {
+    template <typename T>
+    bool operator()(T&&) const;
+};
+
+template <typename I, typename S>
+concept has_for_each_while =
+    unqualified_for_each_while<I, S, element_probe&>;
+
+/**
+ * Iterators for which `for_each_while` is expected to beat stepping the
+ * iterator by hand, either through their own hook or through segments.
+ */
+template <typename I, typename S>
+concept internally_iterable =
+    has_for_each_while<I, S> || segmented_iterator<I, S>;
+
+struct for_each_while_t {
+    template <std::input_iterator I, std::sentinel_for<I> S, typename F>
+    requires std::invocable<F&, iter_reference_t<I>> &&
+        std::convertible_to<std::invoke_result_t<F&, iter_reference_t<I>>,
+            bool>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, F&& sink) RXX_CONST_CALL {
+        if constexpr (unqualified_for_each_while<I, S, F&>) {
+            return for_each_while(__RXX move(first), __RXX move(last), sink);
+        } else if constexpr (segmented_iterator<I, S>) {
+            return ranges::for_each_segment(__RXX move(first),
+                __RXX move(last), [&](auto local, auto local_last) {
+                    return for_each_while_t{}(
+                        __RXX move(local), __RXX move(local_last), sink);
+                });
+        } else {
+            for (; first != last; ++first) {
+                if (!std::invoke(sink, *first)) {
+                    break;
+                }
+            }
+            return first;
+        }
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+/**
+ * Pushes the elements of [first, last) into `sink` in order until it
+ * returns false, and returns the position of the element that stopped the
+ * walk, or an iterator equal to `last` if none did.
+ *
+ * Views whose iterators carry a resumable state machine (filter, join, ...)
+ * customize this with a hidden friend `for_each_while(first, last, sink)`
+ * written as the plain nested loop, which compilers optimize far better than
+ * the equivalent sequence of `++` and `*`. Segmented iterators are walked one
+ * segment at a time; everything else falls back to the ordinary loop.
+ */
+inline constexpr details::for_each_while_t for_each_while{};
+} // namespace cpo
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
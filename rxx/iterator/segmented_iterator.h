@@ -0,0 +1,71 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/class_or_enum.h"
+#include "rxx/utility/move.h"
+
+#include <concepts>
+#include <iterator>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+namespace details {
+template <typename I, typename S, typename F>
+void for_each_segment(I, S, F) = delete;
+
+template <typename I, typename S, typename F>
+concept unqualified_for_each_segment = class_or_enum<I> &&
+    requires(I first, S last, F visit) {
+        {
+            for_each_segment(__RXX move(first), __RXX move(last), visit)
+        } -> std::same_as<I>;
+    };
+
+/** Visitor used to detect iterators that customize `for_each_segment`. */
+struct segment_probe {
+    template <std::input_iterator L, std::sentinel_for<L> S>
+    L operator()(L first, S last) const;
+};
+
+struct for_each_segment_t {
+    template <std::input_iterator I, std::sentinel_for<I> S, typename F>
+    requires unqualified_for_each_segment<I, S, F&>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr I operator()(
+        I first, S last, F&& visit) RXX_CONST_CALL {
+        return for_each_segment(__RXX move(first), __RXX move(last), visit);
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+/**
+ * Walks [first, last) one segment at a time for iterators that opt in by
+ * providing a hidden friend `for_each_segment(first, last, visit)`.
+ *
+ * A segment is a subrange of one underlying range, e.g. one of the ranges of a
+ * `concat_view` or one inner range of a `join_view`. `visit` is invoked as
+ * `visit(local_first, local_last)` for each segment in order, where the local
+ * iterator and sentinel types may differ between segments. It returns the
+ * local iterator where it stopped; if that is not `local_last` the walk ends
+ * there. The result is the iterator into the whole range at which the walk
+ * ended, which compares equal to `last` if every segment was exhausted.
+ *
+ * Algorithms use this to run their per-range fast paths (memmove, memchr,
+ * vectorised loops) over each segment instead of stepping the composite
+ * iterator element by element.
+ */
+inline constexpr details::for_each_segment_t for_each_segment{};
+} // namespace cpo
+
+template <typename I, typename S = I>
+concept segmented_iterator = std::input_iterator<I> &&
+    std::sentinel_for<S, I> &&
+    details::unqualified_for_each_segment<I, S, details::segment_probe&>;
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
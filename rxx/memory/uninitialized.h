@@ -4,12 +4,15 @@
 #include "rxx/config.h"
 
 #include "rxx/algorithm/return_types.h"
+#include "rxx/details/view_traits.h"
 #include "rxx/iterator/iter_traits.h"
 #include "rxx/memory/construct_at.h"
 #include "rxx/memory/destroy_at.h"
 #include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/concepts.h"
 #include "rxx/ranges/primitives.h"
 
+#include <algorithm>
 #include <concepts>
 #include <new> // IWYU pragma: keep
 
@@ -113,6 +116,68 @@ struct destroy_n_t {
     }
 };
 
+struct uninitialized_fill_t : private destroy_t {
+private:
+    template <typename V, typename I, typename S, typename T>
+    __RXX_HIDE_FROM_ABI static constexpr I impl(I first, S last, T const& val) {
+        I idx = first;
+        RXX_TRY {
+            for (; idx != last; ++idx) {
+                ::new (static_cast<void*>(RXX_BUILTIN_addressof(*idx))) V(val);
+            }
+        } RXX_CATCH(...) {
+            destroy_t::impl(first, idx);
+            RXX_RETHROW();
+        }
+
+        return idx;
+    }
+
+public:
+    template <nothrow_forward_iterator I, nothrow_sentinel_for<I> S, typename T>
+    requires std::constructible_from<iter_value_t<I>, T const&>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL I operator()(
+        I first, S last, T const& val) RXX_CONST_CALL {
+        using V = std::remove_reference_t<iter_reference_t<I>>;
+        return impl<V>(__RXX move(first), __RXX move(last), val);
+    }
+
+    template <nothrow_forward_range R, typename T>
+    requires std::constructible_from<range_value_t<R>, T const&>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL borrowed_iterator_t<R> operator()(
+        R&& range, T const& val) RXX_CONST_CALL {
+        return operator()(ranges::begin(range), ranges::end(range), val);
+    }
+};
+
+struct uninitialized_fill_n_t : private destroy_t {
+private:
+    template <typename V, typename I, typename T>
+    __RXX_HIDE_FROM_ABI static constexpr I impl(
+        I first, iter_difference_t<I> count, T const& val) {
+        I idx = first;
+        RXX_TRY {
+            for (; count > 0; ++idx, --count) {
+                ::new (static_cast<void*>(RXX_BUILTIN_addressof(*idx))) V(val);
+            }
+        } RXX_CATCH(...) {
+            destroy_t::impl(first, idx);
+            RXX_RETHROW();
+        }
+
+        return idx;
+    }
+
+public:
+    template <nothrow_forward_iterator I, typename T>
+    requires std::constructible_from<iter_value_t<I>, T const&>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL I operator()(
+        I first, iter_difference_t<I> count, T const& val) RXX_CONST_CALL {
+        using V = std::remove_reference_t<iter_reference_t<I>>;
+        return impl<V>(__RXX move(first), count, val);
+    }
+};
+
 struct uninitialized_copy_t : private destroy_t {
 private:
     template <typename V, typename I, typename S1, typename O, typename Pred>
@@ -152,8 +217,19 @@ public:
     __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr uninitialized_copy_result<
         borrowed_iterator_t<I>, borrowed_iterator_t<O>>
     operator()(I&& in_range, O&& out_range) RXX_CONST_CALL {
-        return operator()(ranges::begin(in_range), ranges::end(in_range),
-            ranges::begin(out_range), ranges::end(out_range));
+        if constexpr (is_repeat_view_like<std::remove_cvref_t<I>> &&
+            sized_range<I> && sized_range<O>) {
+            // Every element is the same value, so this is a fill
+            auto const count = std::min(ranges::distance(out_range),
+                static_cast<range_difference_t<O>>(ranges::size(in_range)));
+            auto out = uninitialized_fill_n_t{}(
+                ranges::begin(out_range), count, *ranges::begin(in_range));
+            return {ranges::next(ranges::begin(in_range), count),
+                __RXX move(out)};
+        } else {
+            return operator()(ranges::begin(in_range), ranges::end(in_range),
+                ranges::begin(out_range), ranges::end(out_range));
+        }
     }
 };
 
@@ -335,67 +411,6 @@ public:
     }
 };
 
-struct uninitialized_fill_t : private destroy_t {
-private:
-    template <typename V, typename I, typename S, typename T>
-    __RXX_HIDE_FROM_ABI static constexpr I impl(I first, S last, T const& val) {
-        I idx = first;
-        RXX_TRY {
-            for (; idx != last; ++idx) {
-                ::new (static_cast<void*>(RXX_BUILTIN_addressof(*idx))) V(val);
-            }
-        } RXX_CATCH(...) {
-            destroy_t::impl(first, idx);
-            RXX_RETHROW();
-        }
-
-        return idx;
-    }
-
-public:
-    template <nothrow_forward_iterator I, nothrow_sentinel_for<I> S, typename T>
-    requires std::constructible_from<iter_value_t<I>, T const&>
-    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL I operator()(
-        I first, S last, T const& val) RXX_CONST_CALL {
-        using V = std::remove_reference_t<iter_reference_t<I>>;
-        return impl<V>(__RXX move(first), __RXX move(last), val);
-    }
-
-    template <nothrow_forward_range R, typename T>
-    requires std::constructible_from<range_value_t<R>, T const&>
-    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL borrowed_iterator_t<R> operator()(
-        R&& range, T const& val) RXX_CONST_CALL {
-        return operator()(ranges::begin(range), ranges::end(range), val);
-    }
-};
-struct uninitialized_fill_n_t : private destroy_t {
-private:
-    template <typename V, typename I, typename T>
-    __RXX_HIDE_FROM_ABI static constexpr I impl(
-        I first, iter_difference_t<I> count, T const& val) {
-        I idx = first;
-        RXX_TRY {
-            for (; count > 0; ++idx, --count) {
-                ::new (static_cast<void*>(RXX_BUILTIN_addressof(*idx))) V(val);
-            }
-        } RXX_CATCH(...) {
-            destroy_t::impl(first, idx);
-            RXX_RETHROW();
-        }
-
-        return idx;
-    }
-
-public:
-    template <nothrow_forward_iterator I, typename T>
-    requires std::constructible_from<iter_value_t<I>, T const&>
-    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL I operator()(
-        I first, iter_difference_t<I> count, T const& val) RXX_CONST_CALL {
-        using V = std::remove_reference_t<iter_reference_t<I>>;
-        return impl<V>(__RXX move(first), count, val);
-    }
-};
-
 struct uninitialized_value_construct_t : private destroy_t {
 private:
     template <typename V, typename I, typename S>
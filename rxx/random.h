@@ -2,5 +2,7 @@
 #pragma once
 
 // IWYU pragma: begin_exports
+#include "rxx/random/entropy_engine.h"
 #include "rxx/random/generate_random.h"
+#include "rxx/random/philox_engine.h"
 // IWYU pragma: end_exports
@@ -0,0 +1,206 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/random/generate_random.h"
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+
+#if RXX_TARGET_MICROSOFT
+#  include <random>
+#elif RXX_TARGET_APPLE || RXX_TARGET_BSD
+#  include <stdlib.h>
+#else
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <system_error>
+#  include <unistd.h>
+#  if RXX_TARGET_LINUX && __has_include(<sys/random.h>)
+#    include <sys/random.h>
+#    define RXX_SUPPORTS_GETRANDOM 1
+#  endif
+#endif
+
+#ifndef RXX_SUPPORTS_GETRANDOM
+#  define RXX_SUPPORTS_GETRANDOM 0
+#endif
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+/**
+ * Non-deterministic engine drawing from the operating system's entropy
+ * source, filling an internal buffer several kilobytes at a time.
+ *
+ * Unlike `std::random_device`, which typically issues one system call per
+ * 32-bit value, every system call here is amortised over `buffer_size`
+ * values. The bulk `generate_random` member lets `ranges::generate_random`
+ * write large outputs directly, and `generate` lets the engine seed standard
+ * and rxx engines in place of a `std::seed_seq`.
+ *
+ * On Linux the entropy comes from `getrandom(2)`, falling back to
+ * `/dev/urandom` on kernels predating the system call. Apple and BSD targets
+ * use `arc4random_buf` and Windows uses `std::random_device`.
+ */
+class entropy_engine {
+public:
+    using result_type = uint32_t;
+
+    /** Number of values produced per refill of the internal buffer. */
+    static constexpr size_t buffer_size = 1024;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr result_type min() noexcept { return 0; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr result_type max() noexcept {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    __RXX_HIDE_FROM_ABI entropy_engine() noexcept = default;
+    entropy_engine(entropy_engine const&) = delete;
+    entropy_engine& operator=(entropy_engine const&) = delete;
+
+    __RXX_HIDE_FROM_ABI ~entropy_engine() noexcept {
+#if !RXX_TARGET_MICROSOFT && !RXX_TARGET_APPLE && !RXX_TARGET_BSD
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    __RXX_HIDE_FROM_ABI result_type operator()() {
+        if (position_ == buffer_size) {
+            fill(buffer_, sizeof(buffer_));
+            position_ = 0;
+        }
+
+        return buffer_[position_++];
+    }
+
+    /**
+     * Fills `out` with random values, using buffered values first and then
+     * writing whole multiples of `buffer_size` straight into `out`.
+     */
+    __RXX_HIDE_FROM_ABI void generate_random(std::span<result_type> out) {
+        size_t const buffered = buffer_size - position_;
+        if (out.size() <= buffered) {
+            take(out.data(), out.size());
+            return;
+        }
+
+        take(out.data(), buffered);
+        out = out.subspan(buffered);
+        size_t const direct = out.size() - out.size() % buffer_size;
+        if (direct) {
+            fill(out.data(), direct * sizeof(result_type));
+            out = out.subspan(direct);
+        }
+
+        if (!out.empty()) {
+            fill(buffer_, sizeof(buffer_));
+            position_ = 0;
+            take(out.data(), out.size());
+        }
+    }
+
+    /**
+     * Seed sequence interface, fills [first, last) with 32-bit values so the
+     * engine can be passed wherever a `std::seed_seq` is accepted.
+     */
+    template <std::random_access_iterator It>
+    __RXX_HIDE_FROM_ABI void generate(It first, It last) {
+        for (; first != last; ++first) {
+            *first = (*this)();
+        }
+    }
+
+    template <std::random_access_iterator It>
+    requires std::contiguous_iterator<It> &&
+        std::same_as<std::iter_value_t<It>, result_type>
+    __RXX_HIDE_FROM_ABI void generate(It first, It last) {
+        generate_random(std::span<result_type>(
+            std::to_address(first), static_cast<size_t>(last - first)));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    double entropy() const noexcept {
+        return std::numeric_limits<result_type>::digits;
+    }
+
+private:
+    __RXX_HIDE_FROM_ABI void take(result_type* out, size_t count) {
+        std::memcpy(out, buffer_ + position_, count * sizeof(result_type));
+        position_ += count;
+    }
+
+    /** Fills `size` bytes at `data` from the operating system. */
+    __RXX_HIDE_FROM_ABI void fill(void* data, size_t size) {
+#if RXX_TARGET_MICROSOFT
+        auto* words = static_cast<unsigned int*>(data);
+        std::random_device device;
+        for (size_t idx = 0; idx != size / sizeof(unsigned int); ++idx) {
+            words[idx] = device();
+        }
+#elif RXX_TARGET_APPLE || RXX_TARGET_BSD
+        ::arc4random_buf(data, size);
+#else
+        auto* bytes = static_cast<unsigned char*>(data);
+#  if RXX_SUPPORTS_GETRANDOM
+        while (fd_ < 0 && size) {
+            ssize_t const result = ::getrandom(bytes, size, 0);
+            if (result > 0) {
+                bytes += result;
+                size -= static_cast<size_t>(result);
+            } else if (errno == ENOSYS || errno == EPERM) {
+                // Kernel predates getrandom or a filter forbids it
+                open_urandom();
+            } else if (errno != EINTR) {
+                RXX_THROW(std::system_error(
+                    errno, std::generic_category(), "getrandom"));
+            }
+        }
+#  else
+        if (size && fd_ < 0) {
+            open_urandom();
+        }
+#  endif
+        while (size) {
+            ssize_t const result = ::read(fd_, bytes, size);
+            if (result > 0) {
+                bytes += result;
+                size -= static_cast<size_t>(result);
+            } else if (result == 0 || errno != EINTR) {
+                RXX_THROW(std::system_error(
+                    result ? errno : EIO, std::generic_category(),
+                    "/dev/urandom"));
+            }
+        }
+#endif
+    }
+
+#if !RXX_TARGET_MICROSOFT && !RXX_TARGET_APPLE && !RXX_TARGET_BSD
+    __RXX_HIDE_FROM_ABI void open_urandom() {
+        do {
+            fd_ = ::open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+        } while (fd_ < 0 && errno == EINTR);
+
+        if (fd_ < 0) {
+            RXX_THROW(std::system_error(
+                errno, std::generic_category(), "/dev/urandom"));
+        }
+    }
+
+    int fd_ = -1;
+#endif
+    size_t position_ = buffer_size;
+    result_type buffer_[buffer_size];
+};
+
+RXX_DEFAULT_NAMESPACE_END
@@ -11,63 +11,180 @@
 #include "rxx/ranges/borrow_traits.h"
 #include "rxx/ranges/concepts.h"
 #include "rxx/ranges/primitives.h"
+#include "rxx/ranges/subrange.h"
 
 #include <functional>
 #include <random>
+#include <span>
 #include <type_traits>
 
+#if RXX_ENABLE_EXECUTION_POLICY && __has_include(<execution>)
+#  include <execution>
+#  if __cpp_lib_execution >= 201603L
+#    include <vector>
+#    define RXX_SUPPORTS_EXECUTION_POLICY 1
+#  endif
+#endif
+
 RXX_DEFAULT_NAMESPACE_BEGIN
+
+/**
+ * Opt-in for engines whose `discard` runs in constant time. Such engines can
+ * be positioned anywhere in their sequence cheaply, which the execution policy
+ * overloads of `ranges::generate_random` rely on to hand every partition of
+ * the output its own substream.
+ */
+template <typename G>
+inline constexpr bool enable_constant_time_discard = false;
+
 namespace ranges {
 
 namespace details {
 
+/**
+ * Number of values produced per bulk call when the output cannot be written
+ * in place. Also the extent used to probe for fixed-size bulk members.
+ */
+inline constexpr size_t generate_random_block = 32;
+
+/**
+ * Number of elements per partition for the execution policy overloads. The
+ * partitioning, and therefore the output, does not depend on the number of
+ * threads.
+ */
+inline constexpr size_t generate_random_partition = size_t(1) << 16;
+
+/**
+ * Distance between the substreams given to each partition when a
+ * distribution is involved, as the number of engine invocations per value is
+ * not known up front.
+ */
+inline constexpr unsigned long long generate_random_substream = 1ull << 40;
+
+template <typename G>
+concept seekable_random_engine =
+    std::uniform_random_bit_generator<std::remove_cvref_t<G>> &&
+    std::copy_constructible<std::remove_cvref_t<G>> &&
+    enable_constant_time_discard<std::remove_cvref_t<G>> &&
+    requires(std::remove_cvref_t<G>& engine, unsigned long long z) {
+        engine.discard(z);
+    };
+
+template <typename R, typename I>
+concept generate_random_contiguous = contiguous_range<R> && sized_range<R> &&
+    std::same_as<range_reference_t<R>, I&>;
+
 struct generate_random_t {
+private:
+    /**
+     * Fills `out` using the widest bulk entry point `bulk` provides; a bulk
+     * callable that only accepts `std::span<I, generate_random_block>` fills
+     * whole blocks and leaves the tail to `single`.
+     */
+    template <typename I, typename Bulk, typename Single>
+    __RXX_HIDE_FROM_ABI static constexpr void fill_span(
+        std::span<I> out, Bulk& bulk, Single& single) {
+        if constexpr (std::invocable<Bulk&, std::span<I>>) {
+            std::invoke(bulk, out);
+        } else {
+            constexpr size_t block = generate_random_block;
+            I* ptr = out.data();
+            size_t remaining = out.size();
+            for (; remaining >= block; remaining -= block, ptr += block) {
+                std::invoke(bulk, std::span<I, block>(ptr, block));
+            }
+            for (; remaining; --remaining, ++ptr) {
+                *ptr = std::invoke(single);
+            }
+        }
+    }
+
+    template <typename I, typename R, typename Bulk, typename Single>
+    __RXX_HIDE_FROM_ABI static constexpr borrowed_iterator_t<R> impl(
+        R&& range, Bulk bulk, Single single) {
+        constexpr size_t block = generate_random_block;
+        if constexpr (generate_random_contiguous<R, I>) {
+            // Write straight into the output, no intermediate buffer
+            auto const size = ranges::size(range);
+            fill_span<I>(std::span<I>(ranges::data(range), size), bulk, single);
+            return ranges::begin(range) + size;
+        } else if constexpr (sized_range<R>) {
+            auto it = ranges::begin(range);
+            size_t remaining = ranges::size(range);
+            I buffer[block];
+            while (remaining) {
+                size_t const count = remaining < block ? remaining : block;
+                std::span<I> const chunk(buffer, count);
+                fill_span<I>(chunk, bulk, single);
+                it = ranges::copy(chunk, __RXX move(it)).out;
+                remaining -= count;
+            }
+            return it;
+        } else {
+            // The length is unknown, so whole blocks are generated and any
+            // values left over once the output is exhausted are discarded
+            auto it = ranges::begin(range);
+            auto const last = ranges::end(range);
+            I buffer[block];
+            while (it != last) {
+                fill_span<I>(std::span<I>(buffer), bulk, single);
+                for (I* ptr = buffer; ptr != buffer + block && it != last;
+                     ++ptr, ++it) {
+                    *it = *ptr;
+                }
+            }
+            return it;
+        }
+    }
+
+#if RXX_SUPPORTS_EXECUTION_POLICY
+    /**
+     * Invokes `func(index, offset, count)` for every partition of `[0, size)`
+     * under the given execution policy.
+     */
+    template <typename Ep, typename F>
+    __RXX_HIDE_FROM_ABI static void for_each_partition(
+        Ep&& policy, size_t size, F func) {
+        constexpr size_t partition = generate_random_partition;
+        std::vector<size_t> indices((size + partition - 1) / partition);
+        for (size_t idx = 0; idx != indices.size(); ++idx) {
+            indices[idx] = idx;
+        }
+
+        std::for_each(__RXX forward<Ep>(policy), indices.begin(),
+            indices.end(), [&](size_t idx) {
+                size_t const offset = idx * partition;
+                size_t const remaining = size - offset;
+                func(idx, offset,
+                    remaining < partition ? remaining : partition);
+            });
+    }
+#endif
+
+public:
     template <typename R, typename G>
     requires output_range<R, std::invoke_result_t<G&>> &&
         std::uniform_random_bit_generator<std::remove_cvref_t<G>>
     __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr borrowed_iterator_t<R>
     operator()(R&& range, G&& generator) RXX_CONST_CALL {
+        using I = std::invoke_result_t<G&>;
         if constexpr (requires {
                           generator.generate_random(std::declval<R>());
                       }) {
             generator.generate_random(__RXX forward<R>(range));
-            return range.end();
-        } else if constexpr (sized_range<R>) {
-            using I = std::invoke_result_t<G&>;
-            if constexpr (requires(std::span<I, 32> s) {
-                              generator.generate_random(s);
-                          }) {
-                auto remaining = ranges::distance(range.begin(), range.end());
-                for (auto it = range.begin(); it != range.end();) {
-                    if (remaining >= 32) {
-                        I buffer[32];
-                        generator.generate_random(buffer);
-                        it = ranges::copy(buffer, it).out;
-                        remaining -= 32;
-                    } else { // Tail
-                        return ranges::generate(
-                            __RXX move(it), range.end(), std::ref(generator));
-                    }
-                }
-                return range.end();
-            } else if constexpr (requires(std::span<I> s) {
-                                     generator.generate_random(s);
-                                 }) {
-                auto remaining = ranges::distance(range.begin(), range.end());
-                constexpr size_t vec_size = 16;
-                for (auto it = range.begin(); it != range.end();) {
-                    if (remaining >= vec_size) {
-                        I buffer[vec_size];
-                        generator.generate_random(std::span<I>{buffer});
-                        it = ranges::copy(buffer, it).out;
-                        remaining -= vec_size;
-                    } else { // Tail
-                        return ranges::generate(
-                            __RXX move(it), range.end(), std::ref(generator));
-                    }
-                }
-                return range.end();
-            }
+            return ranges::next(ranges::begin(range), ranges::end(range));
+        } else if constexpr (requires(std::span<I> s) {
+                                 generator.generate_random(s);
+                             } ||
+            requires(std::span<I, generate_random_block> s) {
+                generator.generate_random(s);
+            }) {
+            return impl<I>(
+                __RXX forward<R>(range),
+                [&]<typename Span>(Span out)
+                requires requires { generator.generate_random(out); }
+                { generator.generate_random(out); },
+                [&]() { return std::invoke(generator); });
         } else {
             return ranges::generate(
                 __RXX forward<R>(range), std::ref(generator));
@@ -90,53 +207,27 @@ struct generate_random_t {
         std::is_arithmetic_v<std::invoke_result_t<D&, G&>>
     __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr ranges::borrowed_iterator_t<R>
     operator()(R&& range, G&& generator, D&& distribution) RXX_CONST_CALL {
+        using I = std::invoke_result_t<D&, G&>;
         if constexpr (requires {
                           distribution.generate_random(
                               std::declval<R>(), generator);
                       }) {
             distribution.generate_random(__RXX forward<R>(range), generator);
-            return range.end();
-        } else if constexpr (sized_range<R>) {
-            using I = std::invoke_result_t<D&, G&>;
-            if constexpr (requires(std::span<I, 32> s) {
-                              distribution.generate_random(s, generator);
-                          }) {
-                auto remaining = ranges::distance(range.begin(), range.end());
-                for (auto it = range.begin(); it != range.end();) {
-                    if (remaining >= 32) {
-                        I buffer[32];
-                        distribution.generate_random(buffer, generator);
-                        it = ranges::copy(buffer, it).out;
-                        remaining -= 32;
-                    } else { // Tail
-                        return ranges::generate(
-                            __RXX move(it), range.end(), [&]() {
-                                return std::invoke(distribution, generator);
-                            });
-                    }
-                }
-                return range.end();
-            } else if constexpr (requires(std::span<I> s) {
-                                     distribution.generate_random(s, generator);
-                                 }) {
-                constexpr size_t vec_size = 16;
-                auto remaining = ranges::distance(range.begin(), range.end());
-                for (auto it = range.begin(); it != range.end();) {
-                    if (remaining >= vec_size) {
-                        I buffer[vec_size];
-                        distribution.generate_random(
-                            std::span<I>{buffer}, generator);
-                        it = ranges::copy(buffer, it).out;
-                        remaining -= vec_size;
-                    } else {
-                        return ranges::generate(
-                            __RXX move(it), range.end(), [&]() {
-                                return std::invoke(distribution, generator);
-                            });
-                    }
+            return ranges::next(ranges::begin(range), ranges::end(range));
+        } else if constexpr (requires(std::span<I> s) {
+                                 distribution.generate_random(s, generator);
+                             } ||
+            requires(std::span<I, generate_random_block> s) {
+                distribution.generate_random(s, generator);
+            }) {
+            return impl<I>(
+                __RXX forward<R>(range),
+                [&]<typename Span>(Span out)
+                requires requires {
+                    distribution.generate_random(out, generator);
                 }
-                return range.end();
-            }
+                { distribution.generate_random(out, generator); },
+                [&]() { return std::invoke(distribution, generator); });
         } else {
             return ranges::generate(
                 __RXX forward<R>(range),
@@ -150,11 +241,78 @@ struct generate_random_t {
     requires std::invocable<D&, G&> &&
         std::uniform_random_bit_generator<std::remove_cvref_t<G>> &&
         std::is_arithmetic_v<std::invoke_result_t<D&, G&>>
-    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr O generate_random(
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL constexpr O operator()(
         O first, S last, G&& generator, D&& distribution) RXX_CONST_CALL {
         return operator()(ranges::subrange<O, S>(__RXX move(first), last),
             __RXX forward<G>(generator), __RXX forward<D>(distribution));
     }
+
+#if RXX_SUPPORTS_EXECUTION_POLICY
+    /**
+     * Partitions the output into fixed-size blocks and fills them under the
+     * given execution policy. Each block uses a copy of the engine positioned
+     * at the block's offset, so the result is identical to the sequential
+     * overload regardless of the number of threads. On return, `generator`
+     * has been advanced past every value written.
+     */
+    template <typename Ep, random_access_range R, seekable_random_engine G>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Ep>> &&
+        sized_range<R> && output_range<R, std::invoke_result_t<G&>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL borrowed_iterator_t<R> operator()(
+        Ep&& policy, R&& range, G&& generator) RXX_CONST_CALL {
+        using Engine = std::remove_cvref_t<G>;
+        auto const first = ranges::begin(range);
+        auto const size = static_cast<size_t>(ranges::size(range));
+        for_each_partition(__RXX forward<Ep>(policy), size,
+            [&](size_t, size_t offset, size_t count) {
+                Engine engine(generator);
+                engine.discard(offset);
+                auto const begin = first + range_difference_t<R>(offset);
+                operator()(ranges::subrange(
+                               begin, begin + range_difference_t<R>(count)),
+                    engine);
+            });
+        generator.discard(size);
+        return first + range_difference_t<R>(size);
+    }
+
+    /**
+     * Partitions the output into fixed-size blocks and fills them under the
+     * given execution policy. Block `k` draws from a copy of the engine
+     * advanced by `k` substreams and from its own copy of the distribution,
+     * so the result does not depend on the number of threads. On return,
+     * `generator` has been advanced past every substream used.
+     */
+    template <typename Ep, random_access_range R, seekable_random_engine G,
+        typename D>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Ep>> &&
+        sized_range<R> && output_range<R, std::invoke_result_t<D&, G&>> &&
+        std::invocable<D&, G&> &&
+        std::copy_constructible<std::remove_cvref_t<D>> &&
+        std::is_arithmetic_v<std::invoke_result_t<D&, G&>>
+    __RXX_HIDE_FROM_ABI RXX_STATIC_CALL borrowed_iterator_t<R> operator()(
+        Ep&& policy, R&& range, G&& generator,
+        D&& distribution) RXX_CONST_CALL {
+        using Engine = std::remove_cvref_t<G>;
+        using Distribution = std::remove_cvref_t<D>;
+        auto const first = ranges::begin(range);
+        auto const size = static_cast<size_t>(ranges::size(range));
+        for_each_partition(__RXX forward<Ep>(policy), size,
+            [&](size_t idx, size_t offset, size_t count) {
+                Engine engine(generator);
+                engine.discard(idx * generate_random_substream);
+                Distribution dist(distribution);
+                auto const begin = first + range_difference_t<R>(offset);
+                operator()(ranges::subrange(
+                               begin, begin + range_difference_t<R>(count)),
+                    engine, dist);
+            });
+        size_t const partitions = (size + generate_random_partition - 1) /
+            generate_random_partition;
+        generator.discard(partitions * generate_random_substream);
+        return first + range_difference_t<R>(size);
+    }
+#endif
 };
 } // namespace details
 
@@ -0,0 +1,353 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/random/generate_random.h"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace details {
+template <typename Sseq, typename Engine>
+concept seed_sequence_for = !std::is_convertible_v<Sseq, Engine> &&
+    !std::is_convertible_v<Sseq, typename Engine::result_type> &&
+    requires(Sseq& seq, uint_least32_t* ptr) { seq.generate(ptr, ptr); };
+} // namespace details
+
+/**
+ * Counter-based engine as specified for C++26 `std::philox_engine`.
+ *
+ * Every block of `n` outputs is a pure function of the key and a `n * w`-bit
+ * counter, so `discard` and `set_counter` are constant time. This makes the
+ * engine suitable for handing out disjoint, reproducible substreams, see the
+ * execution policy overloads of `ranges::generate_random`.
+ */
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+requires std::unsigned_integral<UIntType>
+class philox_engine {
+    static_assert(n == 2 || n == 4, "word_count must be 2 or 4");
+    static_assert(sizeof...(consts) == n, "Invalid number of constants");
+    static_assert(r > 0, "round_count must be positive");
+    static_assert(0 < w && w <= std::numeric_limits<UIntType>::digits &&
+            w <= 64,
+        "Invalid word_size");
+
+    static constexpr size_t array_size = n / 2;
+    static constexpr UIntType mask = UIntType(~UIntType(0)) >>
+        (std::numeric_limits<UIntType>::digits - w);
+
+    static constexpr std::array<UIntType, n> interleaved{consts...};
+
+    static consteval auto make_multipliers() noexcept {
+        std::array<UIntType, array_size> result{};
+        for (size_t idx = 0; idx != array_size; ++idx) {
+            result[idx] = interleaved[2 * idx] & mask;
+        }
+        return result;
+    }
+
+    static consteval auto make_round_consts() noexcept {
+        std::array<UIntType, array_size> result{};
+        for (size_t idx = 0; idx != array_size; ++idx) {
+            result[idx] = interleaved[2 * idx + 1] & mask;
+        }
+        return result;
+    }
+
+public:
+    using result_type = UIntType;
+
+    static constexpr size_t word_size = w;
+    static constexpr size_t word_count = n;
+    static constexpr size_t round_count = r;
+    static constexpr std::array<result_type, array_size> multipliers =
+        make_multipliers();
+    static constexpr std::array<result_type, array_size> round_consts =
+        make_round_consts();
+    static constexpr result_type default_seed = 20111115u;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr result_type min() noexcept { return 0; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr result_type max() noexcept { return mask; }
+
+    __RXX_HIDE_FROM_ABI constexpr philox_engine() noexcept
+        : philox_engine(default_seed) {}
+
+    __RXX_HIDE_FROM_ABI explicit constexpr philox_engine(
+        result_type value) noexcept {
+        seed(value);
+    }
+
+    template <details::seed_sequence_for<philox_engine> Sseq>
+    __RXX_HIDE_FROM_ABI explicit constexpr philox_engine(Sseq& seq) {
+        seed(seq);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void seed(
+        result_type value = default_seed) noexcept {
+        key_ = {};
+        key_[0] = value & mask;
+        counter_ = {};
+        results_ = {};
+        index_ = n - 1;
+    }
+
+    template <details::seed_sequence_for<philox_engine> Sseq>
+    __RXX_HIDE_FROM_ABI constexpr void seed(Sseq& seq) {
+        constexpr size_t parts = (w + 31) / 32;
+        uint_least32_t buffer[array_size * parts];
+        seq.generate(buffer, buffer + array_size * parts);
+        for (size_t k = 0; k != array_size; ++k) {
+            result_type word = 0;
+            for (size_t j = 0; j != parts; ++j) {
+                word |= static_cast<result_type>(buffer[k * parts + j])
+                    << (32 * j);
+            }
+            key_[k] = word & mask;
+        }
+        counter_ = {};
+        results_ = {};
+        index_ = n - 1;
+    }
+
+    /**
+     * Sets the counter, most significant word first, and discards any
+     * buffered output so that the next value comes from the new counter.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void set_counter(
+        std::array<result_type, n> const& counter) noexcept {
+        for (size_t j = 0; j != n; ++j) {
+            counter_[j] = counter[n - 1 - j] & mask;
+        }
+        index_ = n - 1;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr result_type operator()() noexcept {
+        if (++index_ == n) {
+            refill();
+        }
+        return results_[index_];
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void discard(unsigned long long z) noexcept {
+        unsigned long long const buffered = n - 1 - index_;
+        if (z <= buffered) {
+            index_ += z;
+            return;
+        }
+
+        z -= buffered + 1;
+        increment_counter(z / n);
+        refill();
+        index_ = z % n;
+    }
+
+    /**
+     * Bulk generation, equivalent to `ranges::generate(out, *this)`. Whole
+     * blocks are written straight into `out` instead of going through the
+     * output buffer.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void generate_random(
+        std::span<result_type> out) noexcept {
+        result_type* ptr = out.data();
+        result_type* const last = ptr + out.size();
+        for (; index_ != n - 1 && ptr != last; ++ptr) {
+            *ptr = results_[++index_];
+        }
+
+        for (; static_cast<size_t>(last - ptr) >= n; ptr += n) {
+            auto const block = generate_block(counter_, key_);
+            for (size_t j = 0; j != n; ++j) {
+                ptr[j] = block[j];
+            }
+            increment_counter(1);
+        }
+
+        for (; ptr != last; ++ptr) {
+            *ptr = (*this)();
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        philox_engine const& left, philox_engine const& right) noexcept {
+        // The buffered block is a function of the counter and key whenever
+        // it is still in use
+        return left.counter_ == right.counter_ && left.key_ == right.key_ &&
+            left.index_ == right.index_;
+    }
+
+    template <typename CharT, typename Traits>
+    __RXX_HIDE_FROM_ABI friend std::basic_ostream<CharT, Traits>& operator<<(
+        std::basic_ostream<CharT, Traits>& os, philox_engine const& engine) {
+        auto const flags = os.flags();
+        auto const fill = os.fill();
+        os.flags(std::ios_base::dec | std::ios_base::left);
+        os.fill(os.widen(' '));
+        CharT const space = os.widen(' ');
+        for (auto value : engine.counter_) {
+            os << value << space;
+        }
+        for (auto value : engine.key_) {
+            os << value << space;
+        }
+        os << engine.index_;
+        os.flags(flags);
+        os.fill(fill);
+        return os;
+    }
+
+    template <typename CharT, typename Traits>
+    __RXX_HIDE_FROM_ABI friend std::basic_istream<CharT, Traits>& operator>>(
+        std::basic_istream<CharT, Traits>& is, philox_engine& engine) {
+        auto const flags = is.flags();
+        is.flags(std::ios_base::dec | std::ios_base::skipws);
+        std::array<result_type, n> counter;
+        std::array<result_type, array_size> key;
+        size_t index;
+        for (auto& value : counter) {
+            is >> value;
+        }
+        for (auto& value : key) {
+            is >> value;
+        }
+        is >> index;
+        if (!is.fail() && index < n) {
+            engine.counter_ = counter;
+            engine.key_ = key;
+            engine.index_ = index;
+            if (index != n - 1) {
+                // The counter is always one past the buffered block
+                engine.decrement_counter();
+                engine.refill();
+                engine.index_ = index;
+            }
+        }
+        is.flags(flags);
+        return is;
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, ALWAYS_INLINE)
+    static constexpr void mulhilo(result_type left, result_type right,
+        result_type& hi, result_type& lo) noexcept {
+        if constexpr (w <= 32) {
+            uint_fast64_t const product =
+                uint_fast64_t(left) * uint_fast64_t(right);
+            hi = static_cast<result_type>(product >> w) & mask;
+            lo = static_cast<result_type>(product) & mask;
+        } else {
+#if RXX_SUPPORTS_INT128
+            __uint128_t const product = __uint128_t(left) * __uint128_t(right);
+            hi = static_cast<result_type>(product >> w) & mask;
+            lo = static_cast<result_type>(product) & mask;
+#else
+            uint64_t const a_lo = uint32_t(left);
+            uint64_t const a_hi = uint64_t(left) >> 32;
+            uint64_t const b_lo = uint32_t(right);
+            uint64_t const b_hi = uint64_t(right) >> 32;
+            uint64_t const ll = a_lo * b_lo;
+            uint64_t const lh = a_lo * b_hi;
+            uint64_t const hl = a_hi * b_lo;
+            uint64_t const hh = a_hi * b_hi;
+            uint64_t const mid = (ll >> 32) + uint32_t(lh) + uint32_t(hl);
+            uint64_t const full_hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+            uint64_t const full_lo = (mid << 32) | uint32_t(ll);
+            if constexpr (w == 64) {
+                hi = static_cast<result_type>(full_hi);
+                lo = static_cast<result_type>(full_lo);
+            } else {
+                hi = static_cast<result_type>(
+                         (full_hi << (64 - w)) | (full_lo >> w)) &
+                    mask;
+                lo = static_cast<result_type>(full_lo) & mask;
+            }
+#endif
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr std::array<result_type, n> generate_block(
+        std::array<result_type, n> counter,
+        std::array<result_type, array_size> key) noexcept {
+        for (size_t round = 0; round != r; ++round) {
+            if constexpr (n == 2) {
+                result_type hi, lo;
+                mulhilo(multipliers[0], counter[0], hi, lo);
+                counter = {hi ^ key[0] ^ counter[1], lo};
+            } else {
+                result_type hi0, lo0, hi1, lo1;
+                mulhilo(multipliers[0], counter[0], hi0, lo0);
+                mulhilo(multipliers[1], counter[2], hi1, lo1);
+                counter = {hi1 ^ counter[1] ^ key[0], lo1,
+                    hi0 ^ counter[3] ^ key[1], lo0};
+            }
+
+            for (size_t k = 0; k != array_size; ++k) {
+                key[k] = (key[k] + round_consts[k]) & mask;
+            }
+        }
+        return counter;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void refill() noexcept {
+        results_ = generate_block(counter_, key_);
+        increment_counter(1);
+        index_ = 0;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void increment_counter(
+        unsigned long long z) noexcept {
+        for (size_t j = 0; j != n && z; ++j) {
+            constexpr auto digits =
+                std::numeric_limits<unsigned long long>::digits;
+            if constexpr (w >= digits) {
+                result_type const sum = (counter_[j] + z) & mask;
+                z = sum < counter_[j] ? 1 : 0;
+                counter_[j] = sum;
+            } else {
+                unsigned long long const sum = counter_[j] + (z & mask);
+                counter_[j] = static_cast<result_type>(sum) & mask;
+                z = (z >> w) + (sum >> w);
+            }
+        }
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void decrement_counter() noexcept {
+        for (size_t j = 0; j != n; ++j) {
+            bool const borrow = counter_[j] == 0;
+            counter_[j] = (counter_[j] - 1) & mask;
+            if (!borrow) {
+                break;
+            }
+        }
+    }
+
+    std::array<result_type, n> counter_;
+    std::array<result_type, array_size> key_;
+    std::array<result_type, n> results_;
+    size_t index_;
+};
+
+using philox4x32 = philox_engine<uint_fast32_t, 32, 4, 10, 0xD2511F53,
+    0x9E3779B9, 0xCD9E8D57, 0xBB67AE85>;
+
+using philox4x64 = philox_engine<uint_fast64_t, 64, 4, 10, 0xD2E7470EE14C6C93,
+    0x9E3779B97F4A7C15, 0xCA5A826395121157, 0xBB67AE8584CAA73B>;
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+inline constexpr bool
+    enable_constant_time_discard<philox_engine<UIntType, w, n, r, consts...>> =
+        true;
+
+RXX_DEFAULT_NAMESPACE_END
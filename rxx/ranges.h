@@ -11,7 +11,9 @@
 #include "rxx/ranges/as_rvalue_view.h"
 #include "rxx/ranges/basic_istream_view.h"
 #include "rxx/ranges/borrow_traits.h"
+#include "rxx/ranges/buffered_chunk_view.h"
 #include "rxx/ranges/cache_latest_view.h"
+#include "rxx/ranges/cache_ring_view.h"
 #include "rxx/ranges/cartesian_product_view.h"
 #include "rxx/ranges/chunk_by_view.h"
 #include "rxx/ranges/chunk_view.h"
@@ -21,21 +23,29 @@
 #include "rxx/ranges/counted.h"
 #include "rxx/ranges/drop_view.h"
 #include "rxx/ranges/drop_while_view.h"
+#include "rxx/ranges/dynamic_concat_view.h"
 #include "rxx/ranges/elements_of.h"
 #include "rxx/ranges/elements_view.h"
 #include "rxx/ranges/empty_view.h"
 #include "rxx/ranges/enumerate_view.h"
+#include "rxx/ranges/filter_map_view.h"
 #include "rxx/ranges/filter_view.h"
+#include "rxx/ranges/fixed_step_view.h"
 #include "rxx/ranges/from_range.h"
+#include "rxx/ranges/generate_random_view.h"
 #include "rxx/ranges/iota_view.h"
 #include "rxx/ranges/join_view.h"
 #include "rxx/ranges/join_with_view.h"
 #include "rxx/ranges/lazy_split_view.h"
+#include "rxx/ranges/member_view.h"
+#include "rxx/ranges/memoize_view.h"
 #include "rxx/ranges/owning_view.h"
+#include "rxx/ranges/prefetch_view.h"
 #include "rxx/ranges/primitives.h"
 #include "rxx/ranges/ref_view.h"
 #include "rxx/ranges/repeat_view.h"
 #include "rxx/ranges/reverse_view.h"
+#include "rxx/ranges/runs_view.h"
 #include "rxx/ranges/single_view.h"
 #include "rxx/ranges/slide_view.h"
 #include "rxx/ranges/split_view.h"
@@ -43,6 +53,7 @@
 #include "rxx/ranges/subrange.h"
 #include "rxx/ranges/take_view.h"
 #include "rxx/ranges/take_while_view.h"
+#include "rxx/ranges/tiled_cartesian_product_view.h"
 #include "rxx/ranges/to.h"
 #include "rxx/ranges/to_input_view.h"
 #include "rxx/ranges/transform_view.h"
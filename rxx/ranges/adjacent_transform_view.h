@@ -139,6 +139,20 @@ public:
         return inner_.size();
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<InnerView>
+    {
+        return inner_.reserve_hint();
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<InnerView const>
+    {
+        return inner_.reserve_hint();
+    }
+
 private:
     RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) details::movable_box<F> func_;
     RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) adjacent_view<V, N> inner_;
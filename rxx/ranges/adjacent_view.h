@@ -134,6 +134,28 @@ public:
         return static_cast<SizeType>(size);
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        using SizeType = decltype(ranges::reserve_hint(base_));
+        using CommonType = std::common_type_t<SizeType, size_t>;
+        auto size = static_cast<CommonType>(ranges::reserve_hint(base_));
+        size -= std::min<CommonType>(size, N - 1);
+        return static_cast<SizeType>(size);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        using SizeType = decltype(ranges::reserve_hint(base_));
+        using CommonType = std::common_type_t<SizeType, size_t>;
+        auto size = static_cast<CommonType>(ranges::reserve_hint(base_));
+        size -= std::min<CommonType>(size, N - 1);
+        return static_cast<SizeType>(size);
+    }
+
 private:
     V base_;
 };
@@ -146,35 +168,54 @@ class adjacent_view<V, N>::iterator {
 
     friend class adjacent_view;
 
-    __RXX_HIDE_FROM_ABI static constexpr auto
+    /**
+     * With a random access base the window is kept as its last iterator
+     * alone and the others are computed from it when needed, so the iterator
+     * is N times smaller and each step is a single base step.
+     */
+    static constexpr bool stores_last_only = random_access_range<Base>;
+
+    using Current RXX_NODEBUG = std::conditional_t<stores_last_only,
+        iterator_t<Base>, std::array<iterator_t<Base>, N>>;
+
+    __RXX_HIDE_FROM_ABI static constexpr Current
     build(iterator_t<Base> begin, sentinel_t<Base> end) noexcept(
         std::is_nothrow_default_constructible_v<iterator_t<Base>> &&
         std::is_nothrow_copy_assignable_v<iterator_t<Base>>) {
-        std::array<iterator_t<Base>, N> output{};
-        for (auto& val : output) {
-            val = begin;
-            ranges::advance(begin, 1, end);
+        if constexpr (stores_last_only) {
+            ranges::advance(begin, N - 1, end);
+            return begin;
+        } else {
+            std::array<iterator_t<Base>, N> output{};
+            for (auto& val : output) {
+                val = begin;
+                ranges::advance(begin, 1, end);
+            }
+            return output;
         }
-        return output;
     }
 
-    __RXX_HIDE_FROM_ABI static constexpr auto
+    __RXX_HIDE_FROM_ABI static constexpr Current
     build(as_sentinel_t, iterator_t<Base> begin, iterator_t<Base> end) noexcept(
         std::is_nothrow_default_constructible_v<iterator_t<Base>> &&
         std::is_nothrow_copy_assignable_v<iterator_t<Base>>) {
-        std::array<iterator_t<Base>, N> output{};
-        if constexpr (!bidirectional_range<Base>) {
-            for (auto& val : output) {
-                val = end;
-            }
+        if constexpr (stores_last_only) {
+            return end;
         } else {
-            for (auto idx = 0u; idx < N; ++idx) {
-                output[N - 1 - idx] = end;
-                ranges::advance(begin, -1, end);
+            std::array<iterator_t<Base>, N> output{};
+            if constexpr (!bidirectional_range<Base>) {
+                for (auto& val : output) {
+                    val = end;
+                }
+            } else {
+                for (auto idx = 0u; idx < N; ++idx) {
+                    output[N - 1 - idx] = end;
+                    ranges::advance(end, -1, begin);
+                }
             }
-        }
 
-        return output;
+            return output;
+        }
     }
 
     __RXX_HIDE_FROM_ABI explicit constexpr iterator(iterator_t<Base> begin,
@@ -187,19 +228,68 @@ class adjacent_view<V, N>::iterator {
         : current_{build(tag, begin, end)} {}
 
     __RXX_HIDE_FROM_ABI friend constexpr decltype(auto) get_current(
+        iterator const& iter) noexcept(stores_last_only
+            ? std::is_nothrow_copy_constructible_v<iterator_t<Base>>
+            : true) {
+        return iter.window();
+    }
+
+    __RXX_HIDE_FROM_ABI friend constexpr iterator_t<Base> const& get_last(
         iterator const& iter) noexcept {
-        return (iter.current_);
+        return iter.last();
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD, ALWAYS_INLINE)
-    static constexpr std::array<iterator_t<Base>, N>
-    move_from(std::array<iterator_t<V>, N>&& other) noexcept(
+    static constexpr Current move_from(
+        std::conditional_t<stores_last_only, iterator_t<V>,
+            std::array<iterator_t<V>, N>>&& other) noexcept(
         std::is_nothrow_constructible_v<iterator_t<Base>, iterator_t<V>>)
     requires Const && std::convertible_to<iterator_t<V>, iterator_t<Base>>
     {
-        return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
-            return std::array<iterator_t<Base>, N>{__RXX move(other[Is])...};
-        }(__RXX make_index_sequence_v<N>);
+        if constexpr (stores_last_only) {
+            return __RXX move(other);
+        } else {
+            return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+                return std::array<iterator_t<Base>, N>{
+                    __RXX move(other[Is])...};
+            }(__RXX make_index_sequence_v<N>);
+        }
+    }
+
+    /**
+     * The iterators to each element of the window, by value when they are
+     * computed from the last one.
+     */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD, ALWAYS_INLINE)
+    constexpr decltype(auto) window() const noexcept(stores_last_only
+            ? std::is_nothrow_copy_constructible_v<iterator_t<Base>>
+            : true) {
+        if constexpr (stores_last_only) {
+            return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+                return std::array<iterator_t<Base>, N>{
+                    (current_ - static_cast<difference_type>(N - 1 - Is))...};
+            }(__RXX make_index_sequence_v<N>);
+        } else {
+            return (current_);
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD, ALWAYS_INLINE)
+    constexpr iterator_t<Base> const& last() const noexcept {
+        if constexpr (stores_last_only) {
+            return current_;
+        } else {
+            return current_.back();
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, ALWAYS_INLINE)
+    constexpr void step(range_difference_t<Base> offset) {
+        if constexpr (stores_last_only) {
+            current_ += offset;
+        } else {
+            details::for_each([&](auto& it) { it += offset; }, current_);
+        }
     }
 
     static consteval auto make_iterator_concept() noexcept {
@@ -228,11 +318,15 @@ public:
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto operator*() const {
         return details::transform(
-            [](auto const& it) -> decltype(auto) { return *it; }, current_);
+            [](auto const& it) -> decltype(auto) { return *it; }, window());
     }
 
     __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
-        details::for_each([](auto& it) { ++it; }, current_);
+        if constexpr (stores_last_only) {
+            ++current_;
+        } else {
+            details::for_each([](auto& it) { ++it; }, current_);
+        }
         return *this;
     }
 
@@ -243,7 +337,11 @@ public:
     }
 
     __RXX_HIDE_FROM_ABI constexpr iterator& operator--() {
-        details::for_each([](auto& it) { --it; }, current_);
+        if constexpr (stores_last_only) {
+            --current_;
+        } else {
+            details::for_each([](auto& it) { --it; }, current_);
+        }
         return *this;
     }
 
@@ -256,14 +354,14 @@ public:
     __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset)
     requires random_access_range<Base>
     {
-        details::for_each([&](auto& it) { it += offset; }, current_);
+        step(offset);
         return *this;
     }
 
     __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset)
     requires random_access_range<Base>
     {
-        details::for_each([&](auto& it) { it -= offset; }, current_);
+        step(-offset);
         return *this;
     }
 
@@ -273,20 +371,20 @@ public:
     {
         return details::transform(
             [&](auto const& it) -> decltype(auto) { return it[offset]; },
-            current_);
+            window());
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr bool operator==(
         iterator const& left, iterator const& right) {
-        return left.current_.back() == right.current_.back();
+        return left.last() == right.last();
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr bool operator<(iterator const& left, iterator const& right)
     requires random_access_range<Base>
     {
-        return left.current_.back() < right.current_.back();
+        return left.last() < right.last();
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
@@ -318,7 +416,7 @@ public:
     requires random_access_range<Base> &&
         std::three_way_comparable<iterator_t<Base>>
     {
-        return left.current_.back() <=> right.current_.back();
+        return left.last() <=> right.last();
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
@@ -354,25 +452,26 @@ public:
         iterator const& left, iterator const& right)
     requires std::sized_sentinel_for<iterator_t<Base>, iterator_t<Base>>
     {
-        return left.current_.back() - right.current_.back();
+        return left.last() - right.last();
     }
 
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr auto iter_move(iterator const& self) {
-        return details::transform(ranges::iter_move, self.current_);
+        return details::transform(ranges::iter_move, self.window());
     }
 
     __RXX_HIDE_FROM_ABI friend constexpr void iter_swap(
         iterator const& left, iterator const& right)
     requires std::indirectly_swappable<iterator_t<Base>>
     {
-        [&]<size_t... Is>(__RXX index_sequence<Is...>) {
-            (..., ranges::iter_swap(left.current_[Is], right.current_[Is]));
-        }(__RXX make_index_sequence_v<N>);
+        [&]<size_t... Is>(
+            __RXX index_sequence<Is...>, auto const& lhs, auto const& rhs) {
+            (..., ranges::iter_swap(lhs[Is], rhs[Is]));
+        }(__RXX make_index_sequence_v<N>, left.window(), right.window());
     }
 
 private:
-    std::array<iterator_t<Base>, N> current_{};
+    Current current_{};
 };
 
 template <forward_range V, size_t N>
@@ -403,7 +502,7 @@ public:
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr bool operator==(
         iterator<OtherConst> const& iter, sentinel const& self) {
-        return get_current(iter).back() == self.end_;
+        return get_last(iter) == self.end_;
     }
 
     template <bool OtherConst>
@@ -412,7 +511,7 @@ public:
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr range_difference_t<details::const_if<OtherConst, V>>
     operator-(iterator<OtherConst> const& iter, sentinel const& self) {
-        return get_current(iter).back() - self.end_;
+        return get_last(iter) - self.end_;
     }
 
     template <bool OtherConst>
@@ -421,7 +520,7 @@ public:
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     friend constexpr range_difference_t<details::const_if<OtherConst, V>>
     operator-(sentinel const& self, iterator<OtherConst> const& iter) {
-        return self.end_ - get_current(iter).back();
+        return self.end_ - get_last(iter);
     }
 
 private:
@@ -94,6 +94,20 @@ public:
         return ranges::size(base_);
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
 private:
     V base_{};
 };
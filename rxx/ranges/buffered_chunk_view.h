@@ -0,0 +1,235 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/ceil_div.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/details/to_unsigned_like.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Splits a range into chunks of `size` elements like `chunk_view`, but reads
+ * each chunk ahead into a contiguous buffer and yields it as a `std::span`,
+ * so chunks of a single pass stream can be handed to code working on arrays.
+ * The last chunk may be shorter.
+ *
+ * The buffer is held by the view and reused for every chunk, so a chunk is
+ * only valid until the iterator is incremented. It is allocated on first
+ * use and is not propagated when the view is copied.
+ */
+template <input_range V>
+requires view<V> && std::movable<range_value_t<V>> &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>>
+class buffered_chunk_view : public view_interface<buffered_chunk_view<V>> {
+    using BufferT RXX_NODEBUG = std::vector<range_value_t<V>>;
+
+    class iterator;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr buffered_chunk_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr buffered_chunk_view(V base,
+        range_difference_t<V> size) noexcept(std::
+            is_nothrow_move_constructible_v<V>)
+        : base_{__RXX move(base)}
+        , size_{size} {
+        assert(size > 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator begin() {
+        current_ = __RXX ranges::begin(base_);
+        if (!buffer_) {
+            buffer_.emplace();
+        }
+
+        fill();
+        return iterator(*this);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr std::default_sentinel_t end() const noexcept {
+        return std::default_sentinel;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size()
+    requires sized_range<V>
+    {
+        return details::to_unsigned_like(
+            details::ceil_div(ranges::distance(base_), size_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return details::to_unsigned_like(
+            details::ceil_div(ranges::distance(base_), size_));
+    }
+
+private:
+    /**
+     * Reads the next chunk from the base over the previous one. Elements
+     * that can be assigned from the base are copied over those already in
+     * the buffer, which only grows by the elements actually read, and with a
+     * sized sentinel the chunk length is known before copying.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void fill() {
+        auto& buffer = *buffer_;
+        auto current = __RXX move(*current_);
+        auto const last = ranges::end(base_);
+        auto length = size_;
+        if constexpr (std::sized_sentinel_for<sentinel_t<V>, iterator_t<V>>) {
+            auto const left = last - current;
+            length = left < size_ ? left : size_;
+            buffer.reserve(static_cast<size_t>(length));
+        }
+
+        range_difference_t<V> count = 0;
+        if constexpr (std::assignable_from<range_value_t<V>&,
+                          range_reference_t<V>>) {
+            auto const held = static_cast<range_difference_t<V>>(buffer.size());
+            auto const reused = held < length ? held : length;
+            for (; count != reused && current != last; ++count, ++current) {
+                buffer[static_cast<size_t>(count)] = *current;
+            }
+        } else {
+            buffer.clear();
+        }
+
+        for (; count != length && current != last; ++count, ++current) {
+            buffer.emplace_back(*current);
+        }
+
+        *current_ = __RXX move(current);
+        count_ = count;
+    }
+
+    V base_{};
+    range_difference_t<V> size_ = 0;
+    range_difference_t<V> count_ = 0;
+    details::non_propagating_cache<iterator_t<V>> current_;
+    details::non_propagating_cache<BufferT> buffer_;
+};
+
+template <typename R>
+buffered_chunk_view(R&&, range_difference_t<R>)
+    -> buffered_chunk_view<views::all_t<R>>;
+
+template <input_range V>
+requires view<V> && std::movable<range_value_t<V>> &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>>
+class buffered_chunk_view<V>::iterator {
+    friend buffered_chunk_view;
+
+    __RXX_HIDE_FROM_ABI constexpr explicit iterator(
+        buffered_chunk_view& parent) noexcept
+        : parent_{RXX_BUILTIN_addressof(parent)} {}
+
+public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = std::span<range_value_t<V>>;
+    using difference_type = range_difference_t<V>;
+
+    __RXX_HIDE_FROM_ABI iterator(iterator&&) = default;
+    __RXX_HIDE_FROM_ABI iterator& operator=(iterator&&) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr value_type operator*() const noexcept {
+        assert(*this != std::default_sentinel);
+        return value_type(parent_->buffer_->data(),
+            static_cast<size_t>(parent_->count_));
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        assert(*this != std::default_sentinel);
+        parent_->fill();
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, std::default_sentinel_t) noexcept {
+        return left.get_count() == 0;
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_difference_t<V> get_count() const noexcept {
+        return parent_->count_;
+    }
+
+    buffered_chunk_view* parent_;
+};
+
+namespace views {
+namespace details {
+struct buffered_chunk_t :
+    ranges::details::adaptor_non_closure<buffered_chunk_t> {
+
+    template <viewable_range R, typename D = range_difference_t<R>>
+    requires requires {
+        buffered_chunk_view(std::declval<R>(), std::declval<D>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& arg, std::type_identity_t<D> size) RXX_CONST_CALL
+        noexcept(noexcept(
+            buffered_chunk_view(std::declval<R>(), std::declval<D>()))) {
+        return buffered_chunk_view(__RXX forward<R>(arg), size);
+    }
+
+    template <typename D>
+    requires std::constructible_from<std::decay_t<D>, D>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(D&& size) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<D>, D>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<2>(buffered_chunk_t{}),
+            __RXX forward<D>(size));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::buffered_chunk_t buffered_chunk{};
+}
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,395 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <array>
+#include <compare>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Caches the elements of the last `N` positions that were dereferenced, so
+ * that an expensive prvalue element read several times, in any order, within
+ * a window of `N` positions is only computed once. Unlike `cache_latest_view`
+ * it keeps the category of its base, up to random access.
+ *
+ * An element lives in the slot for its position modulo `N` and is returned
+ * by copy, since two iterators whose positions share a slot may both be
+ * live. A position is only computed again once its slot has been taken by
+ * another position. The ring is held by the view rather than allocated, and
+ * is not propagated when the view is copied.
+ */
+template <input_range V, size_t N>
+requires view<V> && (N > 0) &&
+    (!std::is_reference_v<range_reference_t<V>>) &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>> &&
+    std::copy_constructible<std::remove_cv_t<range_reference_t<V>>>
+class cache_ring_view : public view_interface<cache_ring_view<V, N>> {
+    using CacheT RXX_NODEBUG = std::remove_cv_t<range_reference_t<V>>;
+
+    struct slot {
+        range_difference_t<V> position = -1;
+        details::non_propagating_cache<CacheT> value;
+    };
+
+    class iterator;
+    class sentinel;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr cache_ring_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr cache_ring_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_{__RXX move(base)} {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin() {
+        return iterator(*this, __RXX ranges::begin(base_), 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end() {
+        if constexpr (common_range<V> && sized_range<V>) {
+            return iterator(*this, __RXX ranges::end(base_),
+                static_cast<range_difference_t<V>>(ranges::size(base_)));
+        } else {
+            return sentinel(*this);
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size()
+    requires sized_range<V>
+    {
+        return ranges::size(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return ranges::size(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+private:
+    template <typename I>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT& lookup(
+        I const& current, range_difference_t<V> position) {
+        if (!ring_) {
+            ring_.emplace();
+        }
+
+        auto& entry = (*ring_)[static_cast<size_t>(position) % N];
+        if (entry.position != position) {
+            entry.value.reset();
+            entry.value.emplace_deref(current);
+            entry.position = position;
+        }
+
+        return *entry.value;
+    }
+
+    template <typename I>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT extract(
+        I const& current, range_difference_t<V> position) {
+        auto& entry = (*ring_)[static_cast<size_t>(position) % N];
+        CacheT result = __RXX move(lookup(current, position));
+        entry.value.reset();
+        entry.position = -1;
+        return result;
+    }
+
+    V base_{};
+    details::non_propagating_cache<std::array<slot, N>> ring_;
+};
+
+template <input_range V, size_t N>
+requires view<V> && (N > 0) &&
+    (!std::is_reference_v<range_reference_t<V>>) &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>> &&
+    std::copy_constructible<std::remove_cv_t<range_reference_t<V>>>
+class cache_ring_view<V, N>::iterator {
+    friend cache_ring_view;
+    friend cache_ring_view::sentinel;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(cache_ring_view& parent,
+        iterator_t<V> current, range_difference_t<V> position)
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(current))
+        , position_(position) {}
+
+    static consteval auto make_iterator_concept() noexcept {
+        if constexpr (random_access_range<V>) {
+            return std::random_access_iterator_tag{};
+        } else if constexpr (bidirectional_range<V>) {
+            return std::bidirectional_iterator_tag{};
+        } else if constexpr (forward_range<V>) {
+            return std::forward_iterator_tag{};
+        } else {
+            return std::input_iterator_tag{};
+        }
+    }
+
+public:
+    using iterator_concept = decltype(make_iterator_concept());
+    using value_type = range_value_t<V>;
+    using difference_type = range_difference_t<V>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<V>>)
+    requires std::default_initializable<iterator_t<V>>
+    = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> const& base() const& noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> base() && { return __RXX move(current_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT operator*() const {
+        return parent_->lookup(current_, position_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT operator[](difference_type offset) const
+    requires random_access_range<V>
+    {
+        return parent_->lookup(current_ + offset, position_ + offset);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++current_;
+        ++position_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int)
+    requires forward_range<V>
+    {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--()
+    requires bidirectional_range<V>
+    {
+        --current_;
+        --position_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int)
+    requires bidirectional_range<V>
+    {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset)
+    requires random_access_range<V>
+    {
+        current_ += offset;
+        position_ += offset;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset)
+    requires random_access_range<V>
+    {
+        current_ -= offset;
+        position_ -= offset;
+        return *this;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(iterator iter, difference_type offset)
+    requires random_access_range<V>
+    {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(difference_type offset, iterator iter)
+    requires random_access_range<V>
+    {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator-(iterator iter, difference_type offset)
+    requires random_access_range<V>
+    {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        iterator const& left, iterator const& right) noexcept
+    requires std::sized_sentinel_for<iterator_t<V>, iterator_t<V>>
+    {
+        return left.position_ - right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right)
+    requires std::equality_comparable<iterator_t<V>>
+    {
+        return left.current_ == right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto operator<=>(
+        iterator const& left, iterator const& right) noexcept
+    requires random_access_range<V>
+    {
+        return left.position_ <=> right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr CacheT iter_move(iterator const& iter) {
+        return iter.extract();
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT extract() const {
+        return parent_->extract(current_, position_);
+    }
+
+    cache_ring_view* parent_ = nullptr;
+    iterator_t<V> current_{};
+    range_difference_t<V> position_ = 0;
+};
+
+template <input_range V, size_t N>
+requires view<V> && (N > 0) &&
+    (!std::is_reference_v<range_reference_t<V>>) &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>> &&
+    std::copy_constructible<std::remove_cv_t<range_reference_t<V>>>
+class cache_ring_view<V, N>::sentinel {
+    friend cache_ring_view;
+
+    __RXX_HIDE_FROM_ABI constexpr explicit sentinel(cache_ring_view& parent)
+        : end_(__RXX ranges::end(parent.base_)) {}
+
+public:
+    __RXX_HIDE_FROM_ABI sentinel() noexcept(
+        std::is_nothrow_default_constructible_v<sentinel_t<V>>) = default;
+
+    __RXX_HIDE_FROM_ABI constexpr sentinel_t<V> base() const
+        noexcept(std::is_nothrow_copy_constructible_v<sentinel_t<V>>) {
+        return end_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, sentinel const& right) {
+        return left.current_ == right.end_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_difference_t<V> operator-(
+        iterator const& left, sentinel const& right)
+    requires std::sized_sentinel_for<sentinel_t<V>, iterator_t<V>>
+    {
+        return left.current_ - right.end_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_difference_t<V> operator-(
+        sentinel const& left, iterator const& right)
+    requires std::sized_sentinel_for<sentinel_t<V>, iterator_t<V>>
+    {
+        return left.end_ - right.current_;
+    }
+
+private:
+    sentinel_t<V> end_{};
+};
+
+namespace views {
+namespace details {
+template <size_t N>
+struct cache_ring_t : __RXX ranges::details::adaptor_closure<cache_ring_t<N>> {
+
+    template <viewable_range R>
+    requires requires { cache_ring_view<all_t<R>, N>(std::declval<R>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(cache_ring_view<all_t<R>, N>(std::declval<R>()))) {
+        return cache_ring_view<all_t<R>, N>(__RXX forward<R>(arg));
+    }
+
+    /** Elements that are already references need no caching. */
+    template <viewable_range R>
+    requires std::is_reference_v<range_reference_t<R>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(views::all(std::declval<R>()))) {
+        return views::all(__RXX forward<R>(arg));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+template <size_t N>
+inline constexpr details::cache_ring_t<N> cache_ring{};
+} // namespace cpo
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include "rxx/details/adaptor_closure.h"
 #include "rxx/details/cached_position.h"
 #include "rxx/details/movable_box.h"
+#include "rxx/details/run_boundary.h"
 #include "rxx/iterator.h"
 #include "rxx/ranges/access.h"
 #include "rxx/ranges/all.h"
@@ -27,7 +28,16 @@ namespace details {
 template <typename Pred, typename V>
 concept chunk_by_predicate = view<V> && std::is_object_v<Pred> &&
     std::indirect_binary_predicate<Pred, iterator_t<V>, iterator_t<V>>;
-}
+
+/**
+ * Chunking contiguous scalars by equality, where each boundary is found by
+ * a blocked scan for the first element unequal to the chunk's first.
+ */
+template <typename V, typename Pred>
+concept chunk_by_equal_scalars = contiguous_range<V> && sized_range<V> &&
+    run_scalar<range_value_t<V>> &&
+    is_equality_predicate<Pred, range_value_t<V>>;
+} // namespace details
 
 template <forward_range V, details::chunk_by_predicate<V> Pred>
 class chunk_by_view : public view_interface<chunk_by_view<V, Pred>> {
@@ -82,6 +92,20 @@ public:
 private:
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     constexpr iterator_t<V> find_next(iterator_t<V> current) {
+        if constexpr (details::chunk_by_equal_scalars<V, Pred>) {
+            auto const* const first = std::to_address(current);
+            auto const* const last =
+                ranges::data(base_) + ranges::size(base_);
+            if (first == last) {
+                return current;
+            }
+
+            return current +
+                (details::find_run_end<range_value_t<V>>(
+                     first + 1, last, *first) -
+                    first);
+        }
+
         auto const pred = [this]<typename T, typename U>(
                               T&& left, U&& right) -> bool {
             return !std::invoke(
@@ -97,6 +121,14 @@ private:
     constexpr iterator_t<V> find_prev(iterator_t<V> current)
     requires bidirectional_range<V>
     {
+        if constexpr (details::chunk_by_equal_scalars<V, Pred>) {
+            auto const* const last = std::to_address(current);
+            return current -
+                (last -
+                    details::find_run_start<range_value_t<V>>(
+                        ranges::data(base_), last - 1, last[-1]));
+        }
+
         auto first = __RXX ranges::begin(base_);
         ranges::reverse_view reversed{
             subrange{first, current}
@@ -4,11 +4,13 @@
 #include "rxx/config.h"
 
 #include "rxx/details/concat.h"
+#include "rxx/details/non_propagating_cache.h"
 #include "rxx/details/packed_range_traits.h"
 #include "rxx/details/simple_view.h"
 #include "rxx/details/to_unsigned_like.h"
 #include "rxx/details/tuple_functions.h"
 #include "rxx/iterator.h"
+#include "rxx/iterator/segmented_iterator.h"
 #include "rxx/ranges/all.h"
 #include "rxx/ranges/concepts.h"
 #include "rxx/ranges/get_element.h"
@@ -17,6 +19,8 @@
 #include "rxx/tuple.h"
 #include "rxx/variant.h"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <type_traits>
 
@@ -24,6 +28,52 @@ RXX_DEFAULT_NAMESPACE_BEGIN
 
 namespace ranges {
 
+namespace details {
+template <bool Const, typename R, typename... Rs>
+consteval bool all_but_last_common() noexcept {
+    if constexpr (sizeof...(Rs) == 0) {
+        return true;
+    } else {
+        return requires {
+            requires (common_range<const_if<Const, R>> &&
+                all_but_last_common<Const, Rs...>());
+        };
+    };
+}
+
+template <bool Const, typename... Rs>
+concept concat_is_random_access = details::all_random_access<Const, Rs...> &&
+    all_but_last_common<Const, Rs...>();
+
+template <bool Const, typename... Rs>
+concept concat_is_bidirectional = details::all_bidirectional<Const, Rs...> &&
+    all_but_last_common<Const, Rs...>();
+
+/**
+ * The number of ranges from which random access seeks through a table of the
+ * positions at which each range starts. Indexing random positions over
+ * ranges of a few hundred elements, stepping over the ranges is faster below
+ * about two dozen ranges, the two are even around 32, and the table pulls
+ * ahead as ranges are added.
+ */
+inline constexpr size_t concat_offset_table_min = 32;
+
+template <typename... Rs>
+concept concat_has_offset_table = concat_is_random_access<false, Rs...> &&
+    (sizeof...(Rs) >= concat_offset_table_min);
+
+} // namespace details
+
+/**
+ * Concatenates the given ranges into one range.
+ *
+ * Over `concat_offset_table_min` or more random access ranges, the first
+ * non-const `begin()` or `end()` records where each range starts, and the
+ * iterators it returns seek across ranges with a binary search on `+=`,
+ * `-=`, `[]` and `-`. Iterators of a const view, and concatenations of fewer
+ * ranges, step over the ranges in between one at a time, linear in the
+ * number of ranges. `size()` adds up the sizes of all the ranges.
+ */
 template <input_range... Vs>
 requires (... && view<Vs>) && (sizeof...(Vs) > 0) && details::concatable<Vs...>
 class concat_view : public view_interface<concat_view<Vs...>> {
@@ -34,6 +84,10 @@ class concat_view : public view_interface<concat_view<Vs...>> {
     template <size_t I>
     using View = std::tuple_element_t<I, tuple<Vs...>>;
 
+    using offset_table RXX_NODEBUG =
+        std::array<std::common_type_t<range_difference_t<Vs>...>,
+            sizeof...(Vs)>;
+
 public:
     __RXX_HIDE_FROM_ABI constexpr concat_view() noexcept(
         (... && std::is_nothrow_default_constructible_v<Vs>))
@@ -50,9 +104,13 @@ public:
             std::in_place_index_t<0>,
             iterator_t<View<0>>> &&                          //
         noexcept(ranges::begin(std::declval<View<0>&>())) && //
-        noexcept(std::declval<iterator<false>&>().template satisfy<0>()))
-    requires (!(... && details::simple_view<Vs>))
+        noexcept(std::declval<iterator<false>&>().template satisfy<0>()) &&
+        noexcept(std::declval<concat_view&>().build_offsets()))
+    requires (!(... && details::simple_view<Vs>) ||
+        details::concat_has_offset_table<Vs...>)
     {
+        build_offsets();
+
         auto it = iterator<false>{*this, std::in_place_index<0>,
             ranges::begin(get_element<0>(views_))};
         it.template satisfy<0>();
@@ -81,9 +139,13 @@ public:
             sentinel_t<View<sizeof...(Vs) - 1>>> &&                          //
         noexcept(ranges::begin(std::declval<View<sizeof...(Vs) - 1>&>())) && //
         noexcept(std::declval<iterator<false>&>()
-                .template satisfy<sizeof...(Vs) - 1>()))
-    requires (!(... && details::simple_view<Vs>))
+                .template satisfy<sizeof...(Vs) - 1>()) &&
+        noexcept(std::declval<concat_view&>().build_offsets()))
+    requires (!(... && details::simple_view<Vs>) ||
+        details::concat_has_offset_table<Vs...>)
     {
+        build_offsets();
+
         constexpr auto N = sizeof...(Vs);
         using LastView = View<N - 1>;
         if constexpr (details::all_forward<false, Vs...> &&
@@ -149,8 +211,64 @@ public:
             details::transform(ranges::size, views_));
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires (... && approximately_sized_range<Vs>)
+    {
+        return __RXX apply(
+            [](auto... sizes) {
+                using Type = std::common_type_t<decltype(sizes)...>;
+                return (... + details::to_unsigned_like<Type>(sizes));
+            },
+            details::transform(ranges::reserve_hint, views_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires (... && approximately_sized_range<Vs const>)
+    {
+        return __RXX apply(
+            [](auto... sizes) {
+                using Type = std::common_type_t<decltype(sizes)...>;
+                return (... + details::to_unsigned_like<Type>(sizes));
+            },
+            details::transform(ranges::reserve_hint, views_));
+    }
+
 private:
+    /**
+     * Records the position at which each range starts within the
+     * concatenation, so that iterators can seek across ranges with a binary
+     * search. It is built by the first call to `begin()` or `end()` rather
+     * than by the iterators, so that iterator operations only read it. Like
+     * the cached begin of other views, this assumes that the sizes of the
+     * underlying ranges no longer change once the view is being iterated.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void build_offsets() noexcept(
+        (... && noexcept(ranges::distance(std::declval<Vs&>())))) {
+        if constexpr (details::concat_has_offset_table<Vs...>) {
+            if (offsets_) {
+                return;
+            }
+
+            using Diff = typename offset_table::value_type;
+            offset_table starts{};
+            [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+                (...,
+                    (starts[Is + 1] = starts[Is] +
+                         static_cast<Diff>(
+                             ranges::distance(get_element<Is>(views_)))));
+            }(__RXX make_index_sequence_v<sizeof...(Vs) - 1>);
+            offsets_ = starts;
+        }
+    }
+
     tuple<Vs...> views_;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS)
+    std::conditional_t<details::concat_has_offset_table<Vs...>,
+        details::non_propagating_cache<offset_table>,
+        details::empty_cache>
+        offsets_;
 };
 
 template <typename... Rs>
@@ -158,26 +276,6 @@ concat_view(Rs&&...) -> concat_view<views::all_t<Rs>...>;
 
 namespace details {
 
-template <bool Const, typename R, typename... Rs>
-consteval bool all_but_last_common() noexcept {
-    if constexpr (sizeof...(Rs) == 0) {
-        return true;
-    } else {
-        return requires {
-            requires (common_range<const_if<Const, R>> &&
-                all_but_last_common<Const, Rs...>());
-        };
-    };
-}
-
-template <bool Const, typename... Rs>
-concept concat_is_random_access = details::all_random_access<Const, Rs...> &&
-    all_but_last_common<Const, Rs...>();
-
-template <bool Const, typename... Rs>
-concept concat_is_bidirectional = details::all_bidirectional<Const, Rs...> &&
-    all_but_last_common<Const, Rs...>();
-
 template <bool Const, typename... Vs>
 struct concat_view_iterator_category {};
 
@@ -269,6 +367,9 @@ private:
         }
     }
 
+    static constexpr bool seeks_by_table =
+        !Const && details::concat_has_offset_table<Vs...>;
+
 public:
     using iterator_concept = decltype(make_iterator_concept());
     using value_type = details::concat_value_t<details::const_if<Const, Vs>...>;
@@ -305,7 +406,21 @@ public:
         noexcept(noexcept(*((*this) + pos))) -> decltype(auto)
     requires details::concat_is_random_access<Const, Vs...>
     {
-        return *((*this) + pos);
+        if constexpr (!seeks_by_table) {
+            return *((*this) + pos);
+        } else {
+            // Index the target range directly instead of building an iterator
+            using reference =
+                details::concat_reference_t<details::const_if<Const, Vs>...>;
+            auto const& starts = get_offsets();
+            auto const target = position(starts) + pos;
+            return __RXX iota_table_for<base_iter>(
+                [&]<size_t I>(__RXX details::size_constant<I>) -> reference {
+                    return get_begin<I>()[to_underlying_diff_type<I>(
+                        target - starts[I])];
+                },
+                find_range(starts, target));
+        }
     }
 
     __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
@@ -351,10 +466,21 @@ public:
     {
         __RXX iota_table_for<base_iter>(
             [&]<size_t I>(__RXX details::size_constant<I>) {
-                auto offset = get_iter<I>() - get_begin<I>();
-                if (val > 0) {
+                auto const offset = get_iter<I>() - get_begin<I>();
+                auto const target = offset + val;
+                bool stays = target >= 0;
+                if constexpr (I != sizeof...(Vs) - 1) {
+                    stays = stays && target < ranges::distance(get_view<I>());
+                }
+
+                if (stays) {
+                    get_iter<I>() += to_underlying_diff_type<I>(val);
+                } else if constexpr (seeks_by_table) {
+                    auto const& starts = get_offsets();
+                    seek(starts, starts[I] + target);
+                } else if (val > 0) {
                     advance_fwd<I>(offset, val);
-                } else if (val < 0) {
+                } else {
                     advance_bwd<I>(offset, -val);
                 }
             },
@@ -468,6 +594,13 @@ public:
         iterator const& left, iterator const& right)
     requires details::concat_is_random_access<Const, Vs...>
     {
+        if constexpr (seeks_by_table) {
+            if (left.it_.index() != right.it_.index()) {
+                auto const& starts = left.get_offsets();
+                return left.position(starts) - right.position(starts);
+            }
+        }
+
         // Split into 3 branches to reduce memory usage when compiling with GCC
         auto const cmp = (right.it_.index() < left.it_.index()) -
             (left.it_.index() < right.it_.index());
@@ -601,7 +734,51 @@ public:
             left.it_.index());
     }
 
+    template <typename S, typename F>
+    requires std::same_as<S, iterator> ||
+        std::same_as<S, std::default_sentinel_t>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_segment(
+        iterator first, S last, F&& visit) {
+        __RXX iota_table_for<base_iter>(
+            [&]<size_t I>(__RXX details::size_constant<I>) {
+                first.template visit_segments<I>(last, visit);
+            },
+            first.it_.index());
+        return first;
+    }
+
 private:
+    /**
+     * Hands the rest of the I-th range and every range after it up to `last`
+     * to `visit`, stopping early if `visit` does not exhaust a segment.
+     */
+    template <size_t I, typename S, typename F>
+    __RXX_HIDE_FROM_ABI constexpr void visit_segments(S const& last, F& visit) {
+        if constexpr (I == sizeof...(Vs) - 1) {
+            if constexpr (std::same_as<S, iterator>) {
+                get_iter<I>() =
+                    visit(__RXX move(get_iter<I>()), __RXX get<I>(last.it_));
+            } else {
+                get_iter<I>() = visit(__RXX move(get_iter<I>()), get_end<I>());
+            }
+        } else {
+            if constexpr (std::same_as<S, iterator>) {
+                if (last.it_.index() == I) {
+                    get_iter<I>() = visit(
+                        __RXX move(get_iter<I>()), __RXX get<I>(last.it_));
+                    return;
+                }
+            }
+
+            auto const end = get_end<I>();
+            get_iter<I>() = visit(__RXX move(get_iter<I>()), end);
+            if (get_iter<I>() == end) {
+                it_.template emplace<I + 1>(get_begin<I + 1>());
+                visit_segments<I + 1>(last, visit);
+            }
+        }
+    }
+
     template <size_t I>
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     constexpr auto get_iter() noexcept -> decltype(auto) {
@@ -656,6 +833,53 @@ private:
         }
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr decltype(auto) get_offsets() const noexcept {
+        return *parent_->offsets_;
+    }
+
+    /** The position of the iterator within the whole concatenation. */
+    template <typename Table>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr difference_type position(Table const& starts) const {
+        return __RXX iota_table_for<base_iter>(
+            [&]<size_t I>(__RXX details::size_constant<I>) -> difference_type {
+                return starts[I] + (__RXX get<I>(it_) - get_begin<I>());
+            },
+            it_.index());
+    }
+
+    /**
+     * The range holding the element at `target`: the last one starting at or
+     * before it, which skips empty ranges the same way `satisfy` does. The
+     * search is branchless as the ranges are visited in no particular order.
+     */
+    template <typename Table>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr size_t find_range(
+        Table const& starts, difference_type target) noexcept {
+        size_t index = 0;
+        for (size_t count = sizeof...(Vs); count > 1;) {
+            auto const half = count / 2;
+            index = starts[index + half] <= target ? index + half : index;
+            count -= half;
+        }
+
+        return index;
+    }
+
+    /** Moves to `target` within the range that holds it. */
+    template <typename Table>
+    __RXX_HIDE_FROM_ABI constexpr void seek(
+        Table const& starts, difference_type target) {
+        __RXX iota_table_for<base_iter>(
+            [&]<size_t I>(__RXX details::size_constant<I>) {
+                it_.template emplace<I>(get_begin<I>() +
+                    to_underlying_diff_type<I>(target - starts[I]));
+            },
+            find_range(starts, target));
+    }
+
     template <size_t I>
     __RXX_HIDE_FROM_ABI constexpr void advance_fwd(
         difference_type offset, difference_type steps) {
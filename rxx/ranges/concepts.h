@@ -14,6 +14,10 @@ namespace ranges {
 template <typename R, typename T>
 concept output_range = range<R> && std::output_iterator<iterator_t<R>, T>;
 
+template <typename T>
+concept approximately_sized_range =
+    range<T> && requires(T& arg) { ranges::reserve_hint(arg); };
+
 template <typename T>
 concept forward_range = input_range<T> && std::forward_iterator<iterator_t<T>>;
 
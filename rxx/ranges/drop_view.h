@@ -12,6 +12,7 @@
 #include "rxx/ranges/primitives.h"
 #include "rxx/ranges/repeat_view.h" // IWYU pragma: keep
 #include "rxx/ranges/subrange.h"
+#include "rxx/ranges/take_view.h"
 #include "rxx/utility.h"
 
 #include <ranges>
@@ -85,6 +86,34 @@ concept droping_repeat = dropable<V, N> && !droping_empty<V, N> &&
     __RXX ranges::details::is_repeat_view_like<std::remove_cvref_t<V>> &&
     requires { drop(std::declval<V>(), std::declval<N>()); };
 
+template <typename R>
+inline constexpr bool is_drop_view = false;
+
+template <typename V>
+inline constexpr bool is_drop_view<drop_view<V>> = true;
+
+/**
+ * A sized `drop_view`: how much it already drops is recovered from the
+ * sizes, so further drops are added to it rather than stacked.
+ */
+template <typename V, typename N>
+concept droping_drop_view = dropable<V, N> && !droping_empty<V, N> &&
+    !droping_optional<V, N> && !droping_random_sized_range<V, N> &&
+    is_drop_view<std::remove_cvref_t<V>> &&
+    sized_range<std::remove_cvref_t<V>> &&
+    requires(V&& view) { __RXX forward<V>(view).base(); };
+
+/**
+ * A sized `take_view`: the count it takes is its size, so the drop moves
+ * under it and the take shrinks by what was dropped.
+ */
+template <typename V, typename N>
+concept droping_take_view = dropable<V, N> && !droping_empty<V, N> &&
+    !droping_optional<V, N> && !droping_random_sized_range<V, N> &&
+    is_take_view<std::remove_cvref_t<V>> &&
+    sized_range<std::remove_cvref_t<V>> &&
+    requires(V&& view) { __RXX forward<V>(view).base(); };
+
 struct drop_t : ranges::details::adaptor_non_closure<drop_t> {
 
     template <viewable_range V, typename N = range_difference_t<V>>
@@ -141,10 +170,33 @@ struct drop_t : ranges::details::adaptor_non_closure<drop_t> {
         return drop(__RXX forward<V>(view), __RXX forward<N>(num));
     }
 
+    template <viewable_range V, typename N = range_difference_t<V>>
+    requires droping_drop_view<V, N>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        V&& view, std::type_identity_t<N> num) RXX_CONST_CALL {
+        auto const remaining = ranges::distance(view);
+        auto base = __RXX forward<V>(view).base();
+        auto const dropped = ranges::distance(base) - remaining;
+        return drop_t{}(__RXX move(base), dropped + num);
+    }
+
+    template <viewable_range V, typename N = range_difference_t<V>>
+    requires droping_take_view<V, N>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        V&& view, std::type_identity_t<N> num) RXX_CONST_CALL {
+        auto const taken = ranges::distance(view);
+        auto const dropped = std::min<N>(taken, num);
+        return take_t{}(drop_t{}(__RXX forward<V>(view).base(), dropped),
+            taken - dropped);
+    }
+
     template <viewable_range V, typename N = range_difference_t<V>>
     requires dropable<V, N> &&
         (!(droping_empty<V, N> || droping_optional<V, N> ||
-            droping_random_sized_range<V, N> || droping_repeat<V, N>))
+            droping_random_sized_range<V, N> || droping_repeat<V, N> ||
+            droping_drop_view<V, N> || droping_take_view<V, N>))
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     RXX_STATIC_CALL constexpr decltype(auto)
     operator()(V&& view, std::type_identity_t<N> num) RXX_CONST_CALL noexcept(
@@ -0,0 +1,365 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/iterator_category_of.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/details/to_unsigned_like.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <concepts>
+#include <type_traits>
+#include <vector>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+/**
+ * A forward range of sized random access ranges whose iterators stay valid
+ * once the range that produced them is gone.
+ */
+template <typename V>
+concept dynamically_concatable = forward_range<V> &&
+    random_access_range<range_reference_t<V>> &&
+    sized_range<range_reference_t<V>> &&
+    (std::is_reference_v<range_reference_t<V>> ||
+        borrowed_range<range_reference_t<V>>);
+} // namespace details
+
+/**
+ * The concatenation of a runtime number of ranges, i.e. `concat_view` for a
+ * range of ranges. Like `join_view` it presents the inner ranges one after
+ * the other, but as they are all sized it indexes the position at which each
+ * one starts along with its begin iterator, so that it is random access even
+ * when the outer range is not: seeking is a binary search over the ranges
+ * and the distance between iterators is a subtraction. This makes ragged
+ * data such as `vector<vector<T>>` sortable and partitionable in place.
+ *
+ * The index is computed on first use and cached, and so assumes the number
+ * and sizes of the ranges do not change while the view is being iterated.
+ */
+template <view V>
+requires details::dynamically_concatable<V>
+class dynamic_concat_view : public view_interface<dynamic_concat_view<V>> {
+    using InnerRange = range_reference_t<V>;
+    using InnerIter RXX_NODEBUG = iterator_t<InnerRange>;
+    using difference_type RXX_NODEBUG = range_difference_t<InnerRange>;
+
+    class iterator;
+
+    /**
+     * The position at which each range starts, followed by the total size,
+     * and the begin iterator of each range.
+     */
+    struct index_table {
+        std::vector<difference_type> starts;
+        std::vector<InnerIter> begins;
+    };
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr dynamic_concat_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr dynamic_concat_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_(__RXX move(base)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator begin() {
+        return iterator{table(), 0};
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator end() {
+        auto const& table = this->table();
+        return iterator{table, table.starts.back()};
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto size() {
+        return details::to_unsigned_like(table().starts.back());
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr index_table const& table() {
+        if (!table_) {
+            index_table result;
+            if constexpr (sized_range<V>) {
+                auto const count = static_cast<size_t>(ranges::size(base_));
+                result.starts.reserve(count + 1);
+                result.begins.reserve(count);
+            }
+
+            difference_type total = 0;
+            result.starts.push_back(total);
+            for (auto&& range : base_) {
+                result.begins.push_back(ranges::begin(range));
+                total += static_cast<difference_type>(ranges::distance(range));
+                result.starts.push_back(total);
+            }
+            table_ = __RXX move(result);
+        }
+
+        return *table_;
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    details::non_propagating_cache<index_table> table_;
+};
+
+template <typename R>
+dynamic_concat_view(R&&) -> dynamic_concat_view<views::all_t<R>>;
+
+namespace details {
+template <typename InnerRange>
+consteval auto dynamic_concat_iterator_category() noexcept {
+    if constexpr (std::is_reference_v<range_reference_t<InnerRange>> &&
+        std::derived_from<iterator_category_of<false,
+                              std::remove_reference_t<InnerRange>>,
+            std::random_access_iterator_tag>) {
+        return std::random_access_iterator_tag{};
+    } else {
+        return std::input_iterator_tag{};
+    }
+}
+} // namespace details
+
+template <view V>
+requires details::dynamically_concatable<V>
+class dynamic_concat_view<V>::iterator {
+    friend dynamic_concat_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(
+        index_table const& table, difference_type position)
+        : starts_(table.starts.data())
+        , begins_(table.begins.data())
+        , count_(table.begins.size()) {
+        if (count_ != 0) {
+            seek(position);
+        }
+    }
+
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category =
+        decltype(details::dynamic_concat_iterator_category<InnerRange>());
+    using value_type = range_value_t<InnerRange>;
+    using difference_type = dynamic_concat_view::difference_type;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<InnerIter>) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_reference_t<InnerRange> operator*() const
+        noexcept(noexcept(*std::declval<InnerIter const&>())) {
+        return *current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_reference_t<InnerRange> operator[](
+        difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++position_;
+        if (position_ == starts_[index_ + 1] && index_ + 1 < count_) {
+            seek(position_);
+        } else {
+            ++current_;
+        }
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--() {
+        if (position_ == starts_[index_]) {
+            seek(position_ - 1);
+        } else {
+            --current_;
+            --position_;
+        }
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int) {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset) {
+        auto const target = position_ + offset;
+        if (target >= starts_[index_] &&
+            (target < starts_[index_ + 1] || index_ + 1 == count_)) {
+            current_ += static_cast<iter_difference_t<InnerIter>>(offset);
+            position_ = target;
+        } else {
+            seek(target);
+        }
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset) {
+        return *this += -offset;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(iterator iter, difference_type offset) {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(difference_type offset, iterator iter) {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator-(iterator iter, difference_type offset) {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ - right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ == right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto operator<=>(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ <=> right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr decltype(auto) iter_move(iterator const& iter) noexcept(
+        noexcept(ranges::iter_move(iter.current_))) {
+        return ranges::iter_move(iter.current_);
+    }
+
+    __RXX_HIDE_FROM_ABI friend constexpr void
+    iter_swap(iterator const& left, iterator const& right) noexcept(
+        noexcept(ranges::iter_swap(left.current_, right.current_)))
+    requires std::indirectly_swappable<InnerIter>
+    {
+        ranges::iter_swap(left.current_, right.current_);
+    }
+
+    template <typename F>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_segment(
+        iterator first, iterator last, F&& visit) {
+        first.visit_segments(last, visit);
+        return first;
+    }
+
+private:
+    /**
+     * Hands each range up to `last` to `visit`, stopping early if `visit`
+     * does not exhaust one.
+     */
+    template <typename F>
+    __RXX_HIDE_FROM_ABI constexpr void visit_segments(
+        iterator const& last, F& visit) {
+        while (true) {
+            bool const final = index_ == last.index_;
+            auto const local_last = final ? last.current_
+                                          : current_ +
+                    static_cast<iter_difference_t<InnerIter>>(
+                        starts_[index_ + 1] - position_);
+            auto const local_first = current_;
+            current_ = visit(local_first, local_last);
+            position_ += static_cast<difference_type>(current_ - local_first);
+            if (final || current_ != local_last) {
+                return;
+            }
+
+            seek(position_);
+        }
+    }
+
+    /**
+     * Moves to `target` within the range that holds it: the last one starting
+     * at or before it, which skips empty ranges. The search is branchless as
+     * seeks land in no particular order.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void seek(difference_type target) {
+        size_t index = 0;
+        for (size_t count = count_; count > 1;) {
+            auto const half = count / 2;
+            index = starts_[index + half] <= target ? index + half : index;
+            count -= half;
+        }
+
+        index_ = index;
+        position_ = target;
+        current_ = begins_[index] +
+            static_cast<iter_difference_t<InnerIter>>(target - starts_[index]);
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) InnerIter current_ {};
+    difference_type const* starts_ = nullptr;
+    InnerIter const* begins_ = nullptr;
+    size_t count_ = 0;
+    size_t index_ = 0;
+    difference_type position_ = 0;
+};
+
+namespace views {
+namespace details {
+struct dynamic_concat_t :
+    __RXX ranges::details::adaptor_closure<dynamic_concat_t> {
+    template <typename R>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& range) RXX_CONST_CALL
+        noexcept(noexcept(dynamic_concat_view(__RXX forward<R>(range))))
+            -> decltype(dynamic_concat_view(__RXX forward<R>(range))) {
+        return dynamic_concat_view(__RXX forward<R>(range));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::dynamic_concat_t dynamic_concat{};
+/** Flattens ranges like `views::join`, but into a random access view. */
+inline constexpr details::dynamic_concat_t flatten_indexed{};
+}
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,371 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/cached_position.h"
+#include "rxx/details/iterator_category_of.h"
+#include "rxx/details/movable_box.h"
+#include "rxx/iterator.h"
+#include "rxx/iterator/for_each_while.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+/**
+ * The result of a `filter_map` function: a pointer, or an optional-like type
+ * that tests as engaged and dereferences to the value.
+ */
+template <typename R>
+concept filter_map_result = std::is_pointer_v<R> ||
+    (std::default_initializable<R> && std::movable<R> &&
+        requires(R& result) {
+            static_cast<bool>(result);
+            *result;
+        });
+
+template <typename F, typename V>
+concept filter_map_function = std::is_object_v<F> &&
+    std::regular_invocable<F&, range_reference_t<V>> &&
+    filter_map_result<std::invoke_result_t<F&, range_reference_t<V>>>;
+} // namespace details
+
+/**
+ * Applies `func` to each element once and yields the values it engages,
+ * i.e. `transform(func) | filter(engaged) | transform(deref)` without
+ * calling `func` twice for each element that is kept.
+ *
+ * The result is held in the iterator. When `func` returns optionals the
+ * elements are references into the iterator, so the view is an input range;
+ * when it returns pointers it is up to bidirectional like `filter_view`.
+ */
+template <input_range V, std::move_constructible F>
+requires view<V> && details::filter_map_function<F, V>
+class filter_map_view : public view_interface<filter_map_view<V, F>> {
+    using Result RXX_NODEBUG = std::invoke_result_t<F&, range_reference_t<V>>;
+
+    class iterator;
+    class sentinel;
+
+    static constexpr bool yields_pointee = std::is_pointer_v<Result>;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr filter_map_view() noexcept(
+        std::is_nothrow_default_constructible_v<V> &&
+        std::is_nothrow_default_constructible_v<F>)
+    requires std::default_initializable<V> && std::default_initializable<F>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr filter_map_view(
+        V base, F func) noexcept(std::is_nothrow_move_constructible_v<V> &&
+        std::is_nothrow_move_constructible_v<F>)
+        : base_(__RXX move(base))
+        , func_(std::in_place, __RXX move(func)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator begin() {
+        assert(func_.has_value());
+        if constexpr (forward_range<V> && yields_pointee) {
+            // The cached position is only re-evaluated, not searched again
+            iterator first{*this,
+                cached_begin_ ? cached_begin_.get(base_)
+                              : ranges::begin(base_)};
+            first.satisfy();
+            if (!cached_begin_) {
+                cached_begin_.set(base_, first.current_);
+            }
+            return first;
+        } else {
+            iterator first{*this, ranges::begin(base_)};
+            first.satisfy();
+            return first;
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto end() {
+        if constexpr (common_range<V> && yields_pointee) {
+            return iterator{*this, ranges::end(base_)};
+        } else {
+            return sentinel{*this};
+        }
+    }
+
+    /** The size of the base, an upper bound on the number of values. */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+private:
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) details::movable_box<F> func_;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS)
+    std::conditional_t<yields_pointee, details::cached_position<V>,
+        details::empty_cache>
+        cached_begin_;
+};
+
+template <typename R, typename F>
+filter_map_view(R&&, F) -> filter_map_view<views::all_t<R>, F>;
+
+namespace details {
+template <typename V, bool Pointee>
+struct filter_map_view_iterator_category {};
+
+template <forward_range V>
+struct filter_map_view_iterator_category<V, true> {
+private:
+    using base_category RXX_NODEBUG = details::iterator_category_of<false, V>;
+
+    static consteval auto make_iterator_category() noexcept {
+        if constexpr (std::derived_from<base_category,
+                          std::bidirectional_iterator_tag>) {
+            return std::bidirectional_iterator_tag{};
+        } else {
+            return std::forward_iterator_tag{};
+        }
+    }
+
+public:
+    using iterator_category = decltype(make_iterator_category());
+};
+} // namespace details
+
+template <input_range V, std::move_constructible F>
+requires view<V> && details::filter_map_function<F, V>
+class filter_map_view<V, F>::iterator :
+    public details::filter_map_view_iterator_category<V, yields_pointee> {
+    friend filter_map_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(filter_map_view& parent,
+        iterator_t<V> current) noexcept(std::
+            is_nothrow_move_constructible_v<iterator_t<V>>)
+        : current_(__RXX move(current))
+        , parent_(RXX_BUILTIN_addressof(parent)) {}
+
+    static consteval auto make_iterator_concept() noexcept {
+        if constexpr (!yields_pointee || !forward_range<V>) {
+            return std::input_iterator_tag{};
+        } else if constexpr (bidirectional_range<V>) {
+            return std::bidirectional_iterator_tag{};
+        } else {
+            return std::forward_iterator_tag{};
+        }
+    }
+
+public:
+    using iterator_concept = decltype(make_iterator_concept());
+    using value_type =
+        std::remove_cvref_t<decltype(*std::declval<Result&>())>;
+    using difference_type = range_difference_t<V>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<V>>)
+    requires std::default_initializable<iterator_t<V>>
+    = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> const& base() const& noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> base() && noexcept(
+        std::is_nothrow_move_constructible_v<iterator_t<V>>) {
+        return __RXX move(current_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr decltype(auto) operator*() const
+        noexcept(noexcept(*std::declval<Result&>())) {
+        return *result_;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++current_;
+        satisfy();
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int)
+    requires yields_pointee && forward_range<V>
+    {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--()
+    requires yields_pointee && bidirectional_range<V>
+    {
+        do {
+            --current_;
+            result_ = std::invoke(*parent_->func_, *current_);
+        } while (!result_);
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int)
+    requires yields_pointee && bidirectional_range<V>
+    {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right)
+    requires yields_pointee && std::equality_comparable<iterator_t<V>>
+    {
+        return left.current_ == right.current_;
+    }
+
+    template <typename S, typename Sink>
+    requires std::same_as<S, iterator> || std::same_as<S, sentinel>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_while(
+        iterator first, S last, Sink&& sink) {
+        first.push_while(last, sink);
+        return first;
+    }
+
+private:
+    /** Moves to the first element from `current_` that `func` engages. */
+    __RXX_HIDE_FROM_ABI constexpr void satisfy() {
+        auto const last = ranges::end(parent_->base_);
+        for (; current_ != last; ++current_) {
+            result_ = std::invoke(*parent_->func_, *current_);
+            if (result_) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Pushes the engaged values up to `last` into `sink` as one loop over the
+     * base, leaving the value that stopped it, if any, in the iterator.
+     */
+    template <typename S, typename Sink>
+    __RXX_HIDE_FROM_ABI constexpr void push_while(S const& last, Sink& sink) {
+        if (current_ == last.base_end()) {
+            return;
+        }
+
+        // The current element has already been evaluated
+        if (!std::invoke(sink, *result_)) {
+            return;
+        }
+
+        auto& func = *parent_->func_;
+        current_ = ranges::for_each_while(__RXX move(++current_),
+            last.base_end(), [&]<typename T>(T&& element) -> bool {
+                result_ = std::invoke(func, __RXX forward<T>(element));
+                return !result_ || std::invoke(sink, *result_);
+            });
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> const& base_end() const noexcept {
+        return current_;
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) iterator_t<V> current_ {};
+    filter_map_view* parent_ = nullptr;
+    // Dereferencing a const iterator yields the same mutable value
+    mutable Result result_{};
+};
+
+template <input_range V, std::move_constructible F>
+requires view<V> && details::filter_map_function<F, V>
+class filter_map_view<V, F>::sentinel {
+    friend filter_map_view;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr sentinel(filter_map_view& parent)
+        : end_(ranges::end(parent.base_)) {}
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr sentinel() noexcept(
+        std::is_nothrow_default_constructible_v<sentinel_t<V>>) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr sentinel_t<V> base() const
+        noexcept(std::is_nothrow_copy_constructible_v<sentinel_t<V>>) {
+        return end_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& iter, sentinel const& sent) {
+        return iter.base() == sent.end_;
+    }
+
+private:
+    friend iterator;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr sentinel_t<V> const& base_end() const noexcept { return end_; }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) sentinel_t<V> end_ {};
+};
+
+namespace views {
+namespace details {
+struct filter_map_t : ranges::details::adaptor_non_closure<filter_map_t> {
+
+    template <typename R, typename F>
+    requires requires {
+        filter_map_view(std::declval<R>(), std::declval<F>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto
+    operator()(R&& arg, F&& func) RXX_CONST_CALL noexcept(noexcept(
+        filter_map_view(__RXX forward<R>(arg), __RXX forward<F>(func)))) {
+        return filter_map_view(__RXX forward<R>(arg), __RXX forward<F>(func));
+    }
+
+    template <typename F>
+    requires std::constructible_from<std::decay_t<F>, F>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(F&& func) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<2>(filter_map_t{}),
+            __RXX forward<F>(func));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::filter_map_t filter_map{};
+}
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
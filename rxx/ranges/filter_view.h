@@ -3,17 +3,392 @@
 
 #include "rxx/config.h"
 
-#include <ranges>
+#include "rxx/algorithm/find.h"
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/cached_position.h"
+#include "rxx/details/has_arrow.h"
+#include "rxx/details/iterator_category_of.h"
+#include "rxx/details/movable_box.h"
+#include "rxx/iterator.h"
+#include "rxx/iterator/for_each_while.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <type_traits>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
+
 namespace ranges {
 
-using std::ranges::filter_view;
+template <input_range V, std::indirect_unary_predicate<iterator_t<V>> Pred>
+requires view<V> && std::is_object_v<Pred>
+class filter_view : public view_interface<filter_view<V, Pred>> {
+
+    class iterator;
+    class sentinel;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr filter_view() noexcept(
+        std::is_nothrow_default_constructible_v<V> &&
+        std::is_nothrow_default_constructible_v<Pred>)
+    requires std::default_initializable<V> && std::default_initializable<Pred>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr filter_view(
+        V base, Pred pred) noexcept(std::is_nothrow_move_constructible_v<V> &&
+        std::is_nothrow_move_constructible_v<Pred>)
+        : base_(__RXX move(base))
+        , pred_(std::in_place, __RXX move(pred)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr Pred const& pred() const noexcept { return *pred_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator begin() {
+        assert(pred_.has_value());
+        if constexpr (forward_range<V>) {
+            if (!cached_begin_) {
+                cached_begin_.set(base_,
+                    ranges::find_if(base_, std::ref(*pred_)));
+            }
+
+            return iterator{*this, cached_begin_.get(base_)};
+        } else {
+            return iterator{*this, ranges::find_if(base_, std::ref(*pred_))};
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto end() {
+        if constexpr (common_range<V>) {
+            return iterator{*this, ranges::end(base_)};
+        } else {
+            return sentinel{*this};
+        }
+    }
+
+    /** The size of the base, an upper bound on the number of matches. */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+private:
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) details::movable_box<Pred> pred_;
+    details::cached_position<V> cached_begin_;
+};
+
+template <typename R, typename Pred>
+filter_view(R&&, Pred) -> filter_view<views::all_t<R>, Pred>;
+
+namespace details {
+template <typename R>
+inline constexpr bool is_filter_view = false;
+
+template <typename V, typename Pred>
+inline constexpr bool is_filter_view<filter_view<V, Pred>> = true;
+
+/** The predicates of two stacked filters, tested in order. */
+template <typename First, typename Second>
+struct conjoined_predicate {
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) First first;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) Second second;
+
+    template <typename T>
+    requires std::predicate<First&, T&> && std::predicate<Second&, T&>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr bool operator()(T&& value) {
+        return std::invoke(first, value) && std::invoke(second, value);
+    }
+
+    template <typename T>
+    requires std::predicate<First const&, T&> &&
+        std::predicate<Second const&, T&>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr bool operator()(T&& value) const {
+        return std::invoke(first, value) && std::invoke(second, value);
+    }
+};
+
+template <typename V>
+struct filter_view_iterator_category {};
+
+template <forward_range V>
+struct filter_view_iterator_category<V> {
+private:
+    using base_category RXX_NODEBUG = details::iterator_category_of<false, V>;
+
+    static consteval auto make_iterator_category() noexcept {
+        if constexpr (std::derived_from<base_category,
+                          std::bidirectional_iterator_tag>) {
+            return std::bidirectional_iterator_tag{};
+        } else if constexpr (std::derived_from<base_category,
+                                 std::forward_iterator_tag>) {
+            return std::forward_iterator_tag{};
+        } else {
+            return base_category{};
+        }
+    }
+
+public:
+    using iterator_category = decltype(make_iterator_category());
+};
+} // namespace details
+
+template <input_range V, std::indirect_unary_predicate<iterator_t<V>> Pred>
+requires view<V> && std::is_object_v<Pred>
+class filter_view<V, Pred>::iterator :
+    public details::filter_view_iterator_category<V> {
+    friend filter_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(filter_view& parent,
+        iterator_t<V> current) noexcept(std::
+            is_nothrow_move_constructible_v<iterator_t<V>>)
+        : current_(__RXX move(current))
+        , parent_(RXX_BUILTIN_addressof(parent)) {}
+
+    static consteval auto make_iterator_concept() noexcept {
+        if constexpr (bidirectional_range<V>) {
+            return std::bidirectional_iterator_tag{};
+        } else if constexpr (forward_range<V>) {
+            return std::forward_iterator_tag{};
+        } else {
+            return std::input_iterator_tag{};
+        }
+    }
+
+public:
+    using iterator_concept = decltype(make_iterator_concept());
+    using value_type = range_value_t<V>;
+    using difference_type = range_difference_t<V>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<V>>)
+    requires std::default_initializable<iterator_t<V>>
+    = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> const& base() const& noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> base() && noexcept(
+        std::is_nothrow_move_constructible_v<iterator_t<V>>) {
+        return __RXX move(current_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_reference_t<V> operator*() const
+        noexcept(noexcept(*std::declval<iterator_t<V> const&>())) {
+        return *current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> operator->() const
+        noexcept(std::is_nothrow_copy_constructible_v<iterator_t<V>>)
+    requires details::has_arrow<iterator_t<V>> && std::copyable<iterator_t<V>>
+    {
+        return current_;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        // The next match is usually close, so a plain loop beats dispatching
+        // into the base's internal iteration on every step
+        current_ = std::ranges::find_if(__RXX move(++current_),
+            ranges::end(parent_->base_), std::ref(*parent_->pred_));
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int)
+    requires forward_range<V>
+    {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--()
+    requires bidirectional_range<V>
+    {
+        do {
+            --current_;
+        } while (!std::invoke(*parent_->pred_, *current_));
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int)
+    requires bidirectional_range<V>
+    {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right)
+    requires std::equality_comparable<iterator_t<V>>
+    {
+        return left.current_ == right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_rvalue_reference_t<V>
+    iter_move(iterator const& iter) noexcept(
+        noexcept(ranges::iter_move(iter.current_))) {
+        return ranges::iter_move(iter.current_);
+    }
+
+    __RXX_HIDE_FROM_ABI friend constexpr void
+    iter_swap(iterator const& left, iterator const& right) noexcept(
+        noexcept(ranges::iter_swap(left.current_, right.current_)))
+    requires std::indirectly_swappable<iterator_t<V>>
+    {
+        ranges::iter_swap(left.current_, right.current_);
+    }
+
+    template <typename S, typename F>
+    requires std::same_as<S, iterator> || std::same_as<S, sentinel>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_while(
+        iterator first, S last, F&& sink) {
+        first.push_while(last, sink);
+        return first;
+    }
+
+private:
+    /**
+     * Pushes the selected elements up to `last` into `sink` as one loop over
+     * the base, which is itself internally iterated where possible.
+     */
+    template <typename S, typename F>
+    __RXX_HIDE_FROM_ABI constexpr void push_while(S const& last, F& sink) {
+        auto& pred = *parent_->pred_;
+        auto const& base_last = [&]() -> auto const& {
+            if constexpr (std::same_as<S, iterator>) {
+                return last.current_;
+            } else {
+                return last.end_;
+            }
+        }();
+
+        current_ = ranges::for_each_while(__RXX move(current_), base_last,
+            [&]<typename T>(T&& element) -> bool {
+                return !std::invoke(pred, element) ||
+                    std::invoke(sink, __RXX forward<T>(element));
+            });
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) iterator_t<V> current_ {};
+    filter_view* parent_ = nullptr;
+};
+
+template <input_range V, std::indirect_unary_predicate<iterator_t<V>> Pred>
+requires view<V> && std::is_object_v<Pred>
+class filter_view<V, Pred>::sentinel {
+    friend filter_view;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr sentinel(filter_view& parent)
+        : end_(ranges::end(parent.base_)) {}
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr sentinel() noexcept(
+        std::is_nothrow_default_constructible_v<sentinel_t<V>>) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr sentinel_t<V> base() const
+        noexcept(std::is_nothrow_copy_constructible_v<sentinel_t<V>>) {
+        return end_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& iter, sentinel const& sent) {
+        return iter.base() == sent.end_;
+    }
+
+private:
+    friend iterator;
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) sentinel_t<V> end_ {};
+};
 
 namespace views {
+namespace details {
+template <typename R, typename Pred>
+concept filtering_filter_view =
+    __RXX ranges::details::is_filter_view<std::remove_cvref_t<R>> &&
+    requires(R&& range, Pred&& pred) {
+        filter_view(__RXX forward<R>(range).base(),
+            __RXX ranges::details::conjoined_predicate<
+                std::remove_cvref_t<decltype(range.pred())>,
+                std::decay_t<Pred>>{range.pred(), __RXX forward<Pred>(pred)});
+    };
+
+struct filter_t : ranges::details::adaptor_non_closure<filter_t> {
+
+    template <typename R, typename Pred>
+    requires (!filtering_filter_view<R, Pred>) && requires {
+        filter_view(std::declval<R>(), std::declval<Pred>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto
+    operator()(R&& arg, Pred&& pred) RXX_CONST_CALL noexcept(noexcept(
+        filter_view(__RXX forward<R>(arg), __RXX forward<Pred>(pred)))) {
+        return filter_view(__RXX forward<R>(arg), __RXX forward<Pred>(pred));
+    }
+
+    /**
+     * Stacked filters become one filter over the innermost base, testing
+     * both predicates, instead of a filter iterator wrapping another.
+     */
+    template <typename R, typename Pred>
+    requires filtering_filter_view<R, Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& arg, Pred&& pred) RXX_CONST_CALL {
+        using Conjoined = __RXX ranges::details::conjoined_predicate<
+            std::remove_cvref_t<decltype(arg.pred())>, std::decay_t<Pred>>;
+        auto conjoined = Conjoined{arg.pred(), __RXX forward<Pred>(pred)};
+        return filter_view(__RXX forward<R>(arg).base(), __RXX move(conjoined));
+    }
+
+    template <typename Pred>
+    requires std::constructible_from<std::decay_t<Pred>, Pred>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(Pred&& pred) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<Pred>, Pred>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<2>(filter_t{}),
+            __RXX forward<Pred>(pred));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-inline constexpr std::decay_t<decltype(std::views::filter)> filter{};
+inline constexpr details::filter_t filter{};
 }
 } // namespace views
 } // namespace ranges
+
 RXX_DEFAULT_NAMESPACE_END
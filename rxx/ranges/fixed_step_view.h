@@ -0,0 +1,206 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/const_if.h"
+#include "rxx/details/fixed_step_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/slide_view.h"
+#include "rxx/ranges/stride_view.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Walks a contiguous range `Step` elements at a time, both fixed at compile
+ * time, yielding the `std::span<T, Extent>` window starting at each
+ * position, or the element itself when `Extent` is 0. Loops over a window
+ * then have a known trip count.
+ *
+ * Only whole windows are part of the range; the elements after the last
+ * one are exposed by `remainder()`.
+ */
+template <view V, size_t Step, size_t Extent>
+requires contiguous_range<V> && sized_range<V> && (Step > 0)
+class fixed_step_view :
+    public view_interface<fixed_step_view<V, Step, Extent>> {
+    static constexpr size_t width = Extent != 0 ? Extent : 1;
+
+    template <bool Const>
+    using element_t RXX_NODEBUG = std::remove_reference_t<
+        range_reference_t<details::const_if<Const, V>>>;
+    template <bool Const>
+    using iterator RXX_NODEBUG =
+        details::fixed_step_iterator<element_t<Const>, Step, Extent>;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr fixed_step_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr fixed_step_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_(__RXX move(base)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto begin() {
+        return iterator<false>(ranges::data(base_), 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin() const
+    requires contiguous_range<V const> && sized_range<V const>
+    {
+        return iterator<true>(ranges::data(base_), 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto end() {
+        return iterator<false>(ranges::data(base_), windows(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end() const
+    requires contiguous_range<V const> && sized_range<V const>
+    {
+        return iterator<true>(ranges::data(base_), windows(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto size() {
+        return static_cast<range_size_t<V>>(windows(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return static_cast<range_size_t<V const>>(windows(base_));
+    }
+
+    /** The trailing elements not covered by any whole window. */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr std::span<element_t<false>> remainder() {
+        return remainder_of(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr std::span<element_t<true>> remainder() const
+    requires contiguous_range<V const> && sized_range<V const>
+    {
+        return remainder_of(base_);
+    }
+
+private:
+    template <typename Base>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr ptrdiff_t windows(Base& base) {
+        auto const size = static_cast<size_t>(ranges::size(base));
+        return size < width ? 0
+                            : static_cast<ptrdiff_t>((size - width) / Step + 1);
+    }
+
+    template <typename Base>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr auto remainder_of(Base& base) {
+        auto const size = static_cast<size_t>(ranges::size(base));
+        auto const count = static_cast<size_t>(windows(base));
+        auto const covered = count == 0 ? 0 : (count - 1) * Step + width;
+        return std::span(ranges::data(base) + covered, size - covered);
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+};
+
+/** Whole `std::span<T, N>` chunks of a contiguous range. */
+template <typename V, size_t N>
+using fixed_chunk_view = fixed_step_view<V, N, N>;
+
+/** Every `N`th element of a contiguous range. */
+template <typename V, size_t N>
+using fixed_stride_view = fixed_step_view<V, N, 0>;
+
+/** Every `std::span<T, N>` window of a contiguous range. */
+template <typename V, size_t N>
+using fixed_slide_view = fixed_step_view<V, 1, N>;
+
+namespace views {
+namespace details {
+/**
+ * Adapts contiguous sized ranges into a `fixed_step_view` and any other
+ * range into the equivalent run time `Fallback` view, if there is one that
+ * yields the same elements. `fixed_chunk` has none, since `views::chunk`
+ * keeps a short last chunk that `fixed_chunk` leaves in `remainder()`.
+ */
+template <size_t Step, size_t Extent, typename Fallback>
+struct fixed_step_t : __RXX ranges::details::adaptor_closure<
+                          fixed_step_t<Step, Extent, Fallback>> {
+private:
+    static constexpr size_t run_time_size = Extent != 0 ? Extent : Step;
+
+public:
+    template <viewable_range R>
+    requires requires {
+        fixed_step_view<all_t<R>, Step, Extent>(std::declval<R>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(
+            fixed_step_view<all_t<R>, Step, Extent>(std::declval<R>()))) {
+        return fixed_step_view<all_t<R>, Step, Extent>(__RXX forward<R>(arg));
+    }
+
+    template <viewable_range R>
+    requires (!std::is_void_v<Fallback>) &&
+        (!contiguous_range<R> || !sized_range<R>) && requires {
+        Fallback{}(std::declval<R>(), range_difference_t<R>(run_time_size));
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL {
+        return Fallback{}(
+            __RXX forward<R>(arg), range_difference_t<R>(run_time_size));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+template <size_t N>
+requires (N > 0)
+inline constexpr details::fixed_step_t<N, N, void> fixed_chunk{};
+template <size_t N>
+requires (N > 0)
+inline constexpr details::fixed_step_t<N, 0, details::stride_t> fixed_stride{};
+template <size_t N>
+requires (N > 0)
+inline constexpr details::fixed_step_t<1, N, details::slide_t> fixed_slide{};
+} // namespace cpo
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
+
+template <typename V, size_t Step, size_t Extent>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    __RXX ranges::fixed_step_view<V, Step, Extent>> =
+    std::ranges::enable_borrowed_range<V>;
@@ -0,0 +1,205 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/movable_box.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/iterator.h"
+#include "rxx/random/generate_random.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <array>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <span>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+namespace details {
+
+/** Number of values drawn at once by `generate_random_view`. */
+inline constexpr size_t generate_random_view_block = 256;
+
+/** Stands in for a distribution when values come straight from the engine. */
+struct engine_output {
+    template <typename G>
+    __RXX_HIDE_FROM_ABI constexpr auto operator()(G& gen) const {
+        return gen();
+    }
+};
+} // namespace details
+
+/**
+ * Infinite input view of random values, either the raw output of the engine
+ * `G` or values of the distribution `D` applied to it.
+ *
+ * Values are produced a block of `generate_random_view_block` at a time
+ * through `ranges::generate_random`, so engines and distributions with a
+ * bulk `generate_random` member are used in bulk. Results that
+ * `ranges::generate_random` does not take are drawn one at a time. Values left in the block
+ * when iteration stops are discarded; copying the view discards the block
+ * held by the copy.
+ *
+ * The engine is referenced rather than owned and must outlive the view.
+ */
+template <std::uniform_random_bit_generator G,
+    std::copy_constructible D = details::engine_output>
+requires std::is_object_v<D> && std::invocable<D&, G&> &&
+    std::default_initializable<std::invoke_result_t<D&, G&>>
+class generate_random_view :
+    public view_interface<generate_random_view<G, D>> {
+    using value_type RXX_NODEBUG = std::invoke_result_t<D&, G&>;
+    static constexpr size_t block_size = details::generate_random_view_block;
+
+    struct block {
+        std::array<value_type, block_size> values;
+        size_t position = block_size;
+    };
+
+    class iterator;
+
+public:
+    __RXX_HIDE_FROM_ABI explicit constexpr generate_random_view(
+        G& gen) noexcept(std::is_nothrow_default_constructible_v<D>)
+    requires std::default_initializable<D>
+        : gen_(RXX_BUILTIN_addressof(gen))
+        , dist_() {}
+
+    __RXX_HIDE_FROM_ABI constexpr generate_random_view(G& gen, D dist) noexcept(
+        std::is_nothrow_move_constructible_v<D>)
+        : gen_(RXX_BUILTIN_addressof(gen))
+        , dist_(std::in_place, __RXX move(dist)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr G& engine() const noexcept { return *gen_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr D const& distribution() const noexcept { return *dist_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator begin() {
+        if (!cache_) {
+            cache_.emplace();
+        }
+        return iterator(*this);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr std::unreachable_sentinel_t end() const noexcept {
+        return std::unreachable_sentinel;
+    }
+
+private:
+    __RXX_HIDE_FROM_ABI constexpr void refill() {
+        std::span<value_type> out(cache_->values);
+        if constexpr (std::same_as<D, details::engine_output>) {
+            ranges::generate_random(out, *gen_);
+        } else if constexpr (requires {
+                                 ranges::generate_random(out, *gen_, *dist_);
+                             }) {
+            ranges::generate_random(out, *gen_, *dist_);
+        } else {
+            // Non-arithmetic results, e.g. std::complex, have no bulk path
+            for (auto& value : out) {
+                value = std::invoke(*dist_, *gen_);
+            }
+        }
+        cache_->position = 0;
+    }
+
+    G* gen_;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) details::movable_box<D> dist_;
+    details::non_propagating_cache<block> cache_;
+};
+
+template <typename G>
+generate_random_view(G&) -> generate_random_view<G>;
+
+template <typename G, typename D>
+generate_random_view(G&, D) -> generate_random_view<G, D>;
+
+template <std::uniform_random_bit_generator G, std::copy_constructible D>
+requires std::is_object_v<D> && std::invocable<D&, G&> &&
+    std::default_initializable<std::invoke_result_t<D&, G&>>
+class generate_random_view<G, D>::iterator {
+    __RXX_HIDE_FROM_ABI explicit constexpr iterator(
+        generate_random_view& parent) noexcept
+        : parent_(RXX_BUILTIN_addressof(parent)) {}
+
+    friend generate_random_view;
+
+public:
+    using iterator_concept = std::input_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = generate_random_view::value_type;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr value_type const& operator*() const {
+        auto& cache = *parent_->cache_;
+        if (cache.position == block_size) {
+            parent_->refill();
+        }
+        return cache.values[cache.position];
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        auto& cache = *parent_->cache_;
+        if (cache.position == block_size) {
+            // Skipping a value still consumes it
+            parent_->refill();
+        }
+        ++cache.position;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const&, std::unreachable_sentinel_t) noexcept {
+        return false;
+    }
+
+private:
+    generate_random_view* parent_;
+};
+
+namespace views {
+namespace details {
+struct generate_random_t {
+    template <typename G>
+    requires requires(G& gen) { generate_random_view(gen); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(G& gen) RXX_CONST_CALL
+        noexcept(noexcept(generate_random_view(gen))) {
+        return generate_random_view(gen);
+    }
+
+    template <typename G, typename D>
+    requires requires(G& gen, D&& dist) {
+        generate_random_view<G, std::decay_t<D>>(gen, __RXX forward<D>(dist));
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(G& gen, D&& dist) RXX_CONST_CALL
+        noexcept(noexcept(generate_random_view<G, std::decay_t<D>>(
+            gen, __RXX forward<D>(dist)))) {
+        return generate_random_view<G, std::decay_t<D>>(
+            gen, __RXX forward<D>(dist));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::generate_random_t generate_random{};
+}
+} // namespace views
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
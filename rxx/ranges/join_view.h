@@ -6,10 +6,13 @@
 #include "rxx/details/adaptor_closure.h"
 #include "rxx/details/as_lvalue.h"
 #include "rxx/details/const_if.h"
+#include "rxx/details/has_arrow.h"
 #include "rxx/details/iterator_category_of.h"
 #include "rxx/details/non_propagating_cache.h"
 #include "rxx/details/simple_view.h"
+#include "rxx/details/static_range_size.h"
 #include "rxx/iterator.h"
+#include "rxx/iterator/segmented_iterator.h"
 #include "rxx/optional/cmp.h" // IWYU pragma: keep
 #include "rxx/optional/optional.h"
 #include "rxx/ranges/access.h"
@@ -101,6 +104,30 @@ public:
         }
     }
 
+    /**
+     * Only provided when the inner ranges all have the same size fixed by
+     * their type, so that the hint is the outer size times that size.
+     */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires sized_range<V> &&
+        details::has_static_range_size<range_reference_t<V>>
+    {
+        return ranges::size(base_) *
+            details::static_range_size<
+                std::remove_cvref_t<range_reference_t<V>>>;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires sized_range<V const> &&
+        details::has_static_range_size<range_reference_t<V const>>
+    {
+        return ranges::size(base_) *
+            details::static_range_size<
+                std::remove_cvref_t<range_reference_t<V const>>>;
+    }
+
 private:
     RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
     static constexpr bool use_outer_cache = !forward_range<V>;
@@ -170,10 +197,6 @@ private:
 public:
     using iterator_category = decltype(make_iterator_category());
 };
-
-template <typename T>
-concept has_arrow = std::is_pointer_v<T> ||
-    (std::is_class_v<T> && requires(T val) { val.operator->(); });
 } // namespace details
 
 template <input_range V>
@@ -210,6 +233,11 @@ class join_view<V>::iterator final :
         }
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD, ALWAYS_INLINE)
+    constexpr auto get_outer_end() const {
+        return ranges::end(parent_->base_);
+    }
+
     __RXX_HIDE_FROM_ABI constexpr void satisfy() {
 
         for (; get_outer() != ranges::end(parent_->base_); ++get_outer()) {
@@ -387,6 +415,57 @@ public:
         return ranges::iter_swap(*left.inner_, *right.inner_);
     }
 
+    template <typename S, typename F>
+    requires std::is_reference_v<range_reference_t<Base>> &&
+        forward_range<Base> && std::sentinel_for<S, iterator>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_segment(
+        iterator first, S last, F&& visit) {
+        auto const outer_end = first.get_outer_end();
+        auto const& outer_last = [&]() -> auto const& {
+            if constexpr (std::same_as<S, iterator>) {
+                return last.outer_;
+            } else {
+                return outer_end;
+            }
+        }();
+
+        if (first.outer_ == outer_last) {
+            if constexpr (std::same_as<S, iterator>) {
+                if (first.outer_ != outer_end) {
+                    first.inner_ =
+                        visit(__RXX move(*first.inner_), *last.inner_);
+                }
+            }
+            return first;
+        }
+
+        auto local = __RXX move(*first.inner_);
+        while (true) {
+            auto const local_end = ranges::end(*first.outer_);
+            local = visit(__RXX move(local), local_end);
+            if (local != local_end) {
+                first.inner_ = __RXX move(local);
+                return first;
+            }
+
+            if (++first.outer_ == outer_last) {
+                break;
+            }
+            local = ranges::begin(*first.outer_);
+        }
+
+        if constexpr (std::same_as<S, iterator>) {
+            if (first.outer_ != outer_end) {
+                first.inner_ =
+                    visit(ranges::begin(*first.outer_), *last.inner_);
+                return first;
+            }
+        }
+
+        first.inner_.reset();
+        return first;
+    }
+
 private:
     RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) OuterType outer_ {};
     nua::optional<InnerIter> inner_{};
@@ -8,7 +8,9 @@
 #include "rxx/details/const_if.h"
 #include "rxx/details/non_propagating_cache.h"
 #include "rxx/details/simple_view.h"
+#include "rxx/details/static_range_size.h"
 #include "rxx/iterator.h"
+#include "rxx/iterator/segmented_iterator.h"
 #include "rxx/ranges/access.h"
 #include "rxx/ranges/all.h"
 #include "rxx/ranges/concepts.h"
@@ -167,7 +169,43 @@ public:
         }
     }
 
+    /**
+     * Only provided when the inner ranges all have the same size fixed by
+     * their type, so that the hint follows from the outer and pattern sizes.
+     */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires sized_range<V> && details::has_static_range_size<InnerRange> &&
+        sized_range<P>
+    {
+        return joined_size<InnerRange>(base_, pattern_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires sized_range<V const> &&
+        details::has_static_range_size<range_reference_t<V const>> &&
+        sized_range<P const>
+    {
+        return joined_size<range_reference_t<V const>>(base_, pattern_);
+    }
+
 private:
+    template <typename Inner, typename Outer, typename Pattern>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr auto joined_size(Outer& outer, Pattern& pattern) {
+        using SizeType =
+            std::common_type_t<range_size_t<Outer>, range_size_t<Pattern>>;
+        auto const count = static_cast<SizeType>(ranges::size(outer));
+        if (count == 0) {
+            return SizeType(0);
+        }
+
+        return static_cast<SizeType>(count *
+            details::static_range_size<std::remove_cvref_t<Inner>> +
+            (count - 1) * static_cast<SizeType>(ranges::size(pattern)));
+    }
+
     using OuterItType RXX_NODEBUG = details::non_propagating_cache<
         std::conditional_t<forward_range<V>, void, iterator_t<V>>>;
     using InnerType RXX_NODEBUG =
@@ -526,7 +564,85 @@ public:
         }
     }
 
+    template <typename S, typename F>
+    requires std::is_reference_v<InnerBase> && forward_range<Base> &&
+        std::sentinel_for<S, iterator>
+    __RXX_HIDE_FROM_ABI friend constexpr iterator for_each_segment(
+        iterator first, S last, F&& visit) {
+        first.visit_segments(last, visit);
+        return first;
+    }
+
 private:
+    /**
+     * Hands the remaining pattern and inner ranges up to `last` to `visit`
+     * in order, stopping early if `visit` does not exhaust a segment.
+     */
+    template <typename S, typename F>
+    __RXX_HIDE_FROM_ABI constexpr void visit_segments(
+        S const& last, F& visit) {
+        auto& pattern = parent_->pattern_;
+        auto const outer_end = ranges::end(parent_->base_);
+        auto const& outer_last = [&]() -> auto const& {
+            if constexpr (std::same_as<S, iterator>) {
+                return last.outer_;
+            } else {
+                return outer_end;
+            }
+        }();
+
+        auto const visit_pattern = [&](auto const& pattern_last) {
+            auto& current = __RXX get<0>(inner_);
+            current = visit(__RXX move(current), pattern_last);
+            return current == pattern_last;
+        };
+
+        auto const visit_inner = [&](auto const& inner_last) {
+            auto& current = __RXX get<1>(inner_);
+            current = visit(__RXX move(current), inner_last);
+            return current == inner_last;
+        };
+
+        while (outer_ != outer_last) {
+            if (inner_.index() == 0) {
+                if (!visit_pattern(ranges::end(pattern))) {
+                    return;
+                }
+                inner_.template emplace<1>(ranges::begin(*outer_));
+            }
+
+            if (!visit_inner(ranges::end(*outer_))) {
+                return;
+            }
+
+            if (++outer_ == outer_end) {
+                inner_.template emplace<0>();
+                return;
+            }
+            inner_.template emplace<0>(ranges::begin(pattern));
+        }
+
+        if constexpr (std::same_as<S, iterator>) {
+            if (outer_ == outer_end) {
+                return;
+            }
+
+            if (last.inner_.index() == 0) {
+                visit_pattern(__RXX get<0>(last.inner_));
+                return;
+            }
+
+            if (inner_.index() == 0) {
+                if (!visit_pattern(ranges::end(pattern))) {
+                    return;
+                }
+                inner_.template emplace<1>(ranges::begin(*outer_));
+            }
+
+            visit_inner(__RXX get<1>(last.inner_));
+        }
+    }
+
     struct nothing_t {};
     using OuterType RXX_NODEBUG =
         std::conditional_t<forward_range<Base>, OuterIter, nothing_t>;
@@ -6,6 +6,7 @@
 #include "rxx/algorithm.h"
 #include "rxx/details/adaptor_closure.h"
 #include "rxx/details/const_if.h"
+#include "rxx/details/find_delimiter.h"
 #include "rxx/details/iterator_category_of.h"
 #include "rxx/details/non_propagating_cache.h"
 #include "rxx/details/simple_view.h"
@@ -224,7 +225,7 @@ public:
         if (pbegin == pend) {
             ++cur();
         } else if constexpr (details::tiny_range<P>) {
-            cur() = ranges::find(__RXX move(cur()), end, *pbegin);
+            cur() = find_delimiter(*pbegin);
             if (cur() != end) {
                 ++cur();
                 if (cur() == end) {
@@ -279,6 +280,27 @@ public:
     }
 
 private:
+    /** Contiguous bytes split on one element are scanned with memchr. */
+    static constexpr bool scans_bytes = contiguous_range<Base> &&
+        sized_range<Base> && details::byte_like<range_value_t<Base>> &&
+        std::same_as<range_value_t<P>, range_value_t<Base>>;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<Base> find_delimiter(auto const& delimiter) {
+        if constexpr (scans_bytes) {
+            auto const* const first = std::to_address(cur());
+            auto const* const last = ranges::data(parent_->base_) +
+                ranges::size(parent_->base_);
+            return cur() +
+                (details::find_delimiter<range_value_t<Base>>(
+                     first, last, delimiter) -
+                    first);
+        } else {
+            return ranges::find(__RXX move(cur()),
+                __RXX ranges::end(parent_->base_), delimiter);
+        }
+    }
+
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     constexpr bool at_end() const noexcept(noexcept(
         std::declval<iterator_t<Base>>() == std::declval<sentinel_t<Base>>())) {
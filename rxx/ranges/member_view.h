@@ -0,0 +1,169 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/const_if.h"
+#include "rxx/details/strided_pointer.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/transform_view.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+template <typename T>
+struct member_pointer_class {};
+template <typename T, typename C>
+struct member_pointer_class<T C::*> {
+    using type = C;
+};
+
+template <typename R, auto Member>
+concept member_of_contiguous_elements = contiguous_range<R> &&
+    sized_range<R> && std::is_member_object_pointer_v<decltype(Member)> &&
+    std::same_as<range_value_t<R>,
+        typename member_pointer_class<decltype(Member)>::type> &&
+    !std::is_volatile_v<std::remove_reference_t<range_reference_t<R>>>;
+} // namespace details
+
+/**
+ * Views the `Member` of every element of a contiguous range of structs as
+ * a random access range. Its iterator is a byte pointer to the member of
+ * the current element and the size of an element, so the algorithms of
+ * this library can read the column at a stride instead of calling a
+ * projection per element.
+ */
+template <view V, auto Member>
+requires details::member_of_contiguous_elements<V, Member>
+class member_view : public view_interface<member_view<V, Member>> {
+    template <bool Const>
+    using member_t RXX_NODEBUG = std::remove_reference_t<decltype((
+        std::declval<range_reference_t<details::const_if<Const, V>>>().*
+        Member))>;
+    template <bool Const>
+    using iterator RXX_NODEBUG = details::strided_pointer<member_t<Const>,
+        static_cast<ptrdiff_t>(sizeof(range_value_t<V>))>;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr member_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr member_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_(__RXX move(base)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) iterator<false> begin() {
+        return iterator_at<false>(base_, 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    iterator<true> begin() const
+    requires details::member_of_contiguous_elements<V const, Member>
+    {
+        return iterator_at<true>(base_, 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) iterator<false> end() {
+        return iterator_at<false>(base_, ranges::size(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    iterator<true> end() const
+    requires details::member_of_contiguous_elements<V const, Member>
+    {
+        return iterator_at<true>(base_, ranges::size(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto size() {
+        return ranges::size(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return ranges::size(base_);
+    }
+
+private:
+    /**
+     * The iterator to the member of the element at `offset`. An empty base
+     * has no member to point to, so both its ends are the null iterator.
+     */
+    template <bool Const, typename Base>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static iterator<Const> iterator_at(Base& base, range_size_t<Base> offset) {
+        if (ranges::empty(base)) {
+            return iterator<Const>();
+        }
+
+        auto* const data = ranges::data(base);
+        return iterator<Const>(RXX_BUILTIN_addressof(data->*Member)) +
+            static_cast<ptrdiff_t>(offset);
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+};
+
+namespace views {
+namespace details {
+template <auto Member>
+struct member_t : __RXX ranges::details::adaptor_closure<member_t<Member>> {
+    template <viewable_range R>
+    requires requires { member_view<all_t<R>, Member>(std::declval<R>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(member_view<all_t<R>, Member>(std::declval<R>()))) {
+        return member_view<all_t<R>, Member>(__RXX forward<R>(arg));
+    }
+
+    /** Other ranges project the member through `views::transform`. */
+    template <viewable_range R>
+    requires (!__RXX ranges::details::member_of_contiguous_elements<R,
+                 Member>) &&
+        requires { views::transform(std::declval<R>(), Member); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL {
+        return views::transform(__RXX forward<R>(arg), Member);
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+template <auto Member>
+requires std::is_member_object_pointer_v<decltype(Member)>
+inline constexpr details::member_t<Member> member{};
+} // namespace cpo
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
+
+template <typename V, auto Member>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<__RXX ranges::member_view<V, Member>> =
+        std::ranges::enable_borrowed_range<V>;
@@ -0,0 +1,263 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <compare>
+#include <memory>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Computes each prvalue element of a sized random access range at most once,
+ * keeping the results in an array with a slot per position. The array is
+ * allocated on first use, is not propagated when the view is copied, and
+ * references into it stay valid for as long as the view. `iter_move` moves
+ * out of the slot, leaving it moved-from as a container element would be.
+ */
+template <random_access_range V>
+requires view<V> && sized_range<V> &&
+    (!std::is_reference_v<range_reference_t<V>>) &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>>
+class memoize_view : public view_interface<memoize_view<V>> {
+    using CacheT RXX_NODEBUG = std::remove_cv_t<range_reference_t<V>>;
+    using Slot RXX_NODEBUG = details::non_propagating_cache<CacheT>;
+
+    class iterator;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr memoize_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr memoize_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_{__RXX move(base)} {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin() {
+        return iterator(*this, __RXX ranges::begin(base_), 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end() {
+        auto const size =
+            static_cast<range_difference_t<V>>(ranges::size(base_));
+        return iterator(*this, __RXX ranges::begin(base_) + size, size);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() { return ranges::size(base_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return ranges::size(base_);
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT& lookup(
+        iterator_t<V> const& current, range_difference_t<V> position) {
+        if (!slots_) {
+            slots_.emplace(std::make_unique<Slot[]>(
+                static_cast<size_t>(ranges::size(base_))));
+        }
+
+        auto& slot = (*slots_)[static_cast<size_t>(position)];
+        if (!slot) {
+            slot.emplace_deref(current);
+        }
+
+        return *slot;
+    }
+
+    V base_{};
+    details::non_propagating_cache<std::unique_ptr<Slot[]>> slots_;
+};
+
+template <typename R>
+memoize_view(R&&) -> memoize_view<views::all_t<R>>;
+
+template <random_access_range V>
+requires view<V> && sized_range<V> &&
+    (!std::is_reference_v<range_reference_t<V>>) &&
+    std::constructible_from<range_value_t<V>, range_reference_t<V>>
+class memoize_view<V>::iterator {
+    friend memoize_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(memoize_view& parent,
+        iterator_t<V> current, range_difference_t<V> position)
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(current))
+        , position_(position) {}
+
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = range_value_t<V>;
+    using difference_type = range_difference_t<V>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<V>>) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> const& base() const& noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> base() && { return __RXX move(current_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT& operator*() const {
+        return parent_->lookup(current_, position_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr CacheT& operator[](difference_type offset) const {
+        return parent_->lookup(current_ + offset, position_ + offset);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++current_;
+        ++position_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--() {
+        --current_;
+        --position_;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int) {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset) {
+        current_ += offset;
+        position_ += offset;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset) {
+        current_ -= offset;
+        position_ -= offset;
+        return *this;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(iterator iter, difference_type offset) {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(difference_type offset, iterator iter) {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator-(iterator iter, difference_type offset) {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ - right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ == right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto operator<=>(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ <=> right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr CacheT&& iter_move(iterator const& iter) {
+        return __RXX move(*iter);
+    }
+
+private:
+    memoize_view* parent_ = nullptr;
+    iterator_t<V> current_{};
+    range_difference_t<V> position_ = 0;
+};
+
+namespace views {
+namespace details {
+struct memoize_t : __RXX ranges::details::adaptor_closure<memoize_t> {
+
+    template <viewable_range R>
+    requires requires { memoize_view(std::declval<R>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(memoize_view(std::declval<R>()))) {
+        return memoize_view(__RXX forward<R>(arg));
+    }
+
+    /** Elements that are already references need no caching. */
+    template <viewable_range R>
+    requires std::is_reference_v<range_reference_t<R>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(views::all(std::declval<R>()))) {
+        return views::all(__RXX forward<R>(arg));
+    }
+
+#if RXX_LIBSTDCXX
+    static constexpr bool _S_has_simple_call_op = true;
+#endif
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::memoize_t memoize{};
+} // namespace cpo
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
@@ -0,0 +1,565 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/const_if.h"
+#include "rxx/details/iterator_category_of.h"
+#include "rxx/details/movable_box.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/details/simple_view.h"
+#include "rxx/functional/identity.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+namespace details {
+/** A pointer, or an lvalue whose address is taken, to prefetch. */
+template <typename T>
+concept prefetch_target =
+    std::is_pointer_v<std::remove_cvref_t<T>> || std::is_lvalue_reference_v<T>;
+
+template <typename Proj, typename V>
+concept prefetch_projection = std::is_object_v<Proj> &&
+    std::regular_invocable<Proj&, range_reference_t<V>> &&
+    prefetch_target<std::invoke_result_t<Proj&, range_reference_t<V>>>;
+
+template <typename T>
+__RXX_HIDE_FROM_ABI constexpr void prefetch_address(T&& target) noexcept {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::is_pointer_v<std::remove_cvref_t<T>>) {
+            RXX_BUILTIN_prefetch(const_cast<void const*>(
+                static_cast<void const volatile*>(target)));
+        } else {
+            RXX_BUILTIN_prefetch(const_cast<void const*>(
+                static_cast<void const volatile*>(
+                    RXX_BUILTIN_addressof(target))));
+        }
+    }
+}
+
+/**
+ * Whether the element ahead is found by indexing. Otherwise a second
+ * iterator is kept that many elements ahead.
+ */
+template <typename Base>
+concept prefetch_indexes_ahead = random_access_range<Base> &&
+    std::sized_sentinel_for<sentinel_t<Base>, iterator_t<Base>>;
+} // namespace details
+
+/**
+ * Issues a software prefetch for `proj(*(it + distance))` each time an
+ * iterator is incremented, so that gathers through indices or pointers can
+ * overlap the memory latency of later elements with the work on the current
+ * one. The elements themselves are passed through unchanged.
+ *
+ * With a random access base the element ahead is indexed; otherwise the
+ * iterator dereferences a second base iterator kept `distance` elements
+ * ahead, which is clamped at the end of the range.
+ */
+template <forward_range V, typename Proj = identity>
+requires view<V> && details::prefetch_projection<Proj, V>
+class prefetch_view : public view_interface<prefetch_view<V, Proj>> {
+    template <bool Const>
+    class iterator;
+    template <bool Const>
+    class sentinel;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr prefetch_view() noexcept(
+        std::is_nothrow_default_constructible_v<V> &&
+        std::is_nothrow_default_constructible_v<Proj>)
+    requires std::default_initializable<V> && std::default_initializable<Proj>
+    = default;
+
+    __RXX_HIDE_FROM_ABI constexpr prefetch_view(V base,
+        range_difference_t<V> distance,
+        Proj proj = Proj()) noexcept(std::is_nothrow_move_constructible_v<V> &&
+        std::is_nothrow_move_constructible_v<Proj>)
+        : base_(__RXX move(base))
+        , proj_(std::in_place, __RXX move(proj))
+        , distance_(distance) {
+        assert(distance > 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_difference_t<V> distance() const noexcept {
+        return distance_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin()
+    requires (!details::simple_view<V>)
+    {
+        return iterator<false>(*this, __RXX ranges::begin(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin() const
+    requires forward_range<V const> &&
+        details::prefetch_projection<Proj const, V const>
+    {
+        return iterator<true>(*this, __RXX ranges::begin(base_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end()
+    requires (!details::simple_view<V>)
+    {
+        if constexpr (common_range<V>) {
+            return iterator<false>(
+                *this, __RXX ranges::end(base_), iterator<false>::at_end);
+        } else {
+            return sentinel<false>(__RXX ranges::end(base_));
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end() const
+    requires forward_range<V const> &&
+        details::prefetch_projection<Proj const, V const>
+    {
+        if constexpr (common_range<V const>) {
+            return iterator<true>(
+                *this, __RXX ranges::end(base_), iterator<true>::at_end);
+        } else {
+            return sentinel<true>(__RXX ranges::end(base_));
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size()
+    requires sized_range<V>
+    {
+        return ranges::size(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires sized_range<V const>
+    {
+        return ranges::size(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        return ranges::reserve_hint(base_);
+    }
+
+private:
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) details::movable_box<Proj> proj_;
+    range_difference_t<V> distance_ = 1;
+};
+
+template <typename R>
+prefetch_view(R&&, range_difference_t<R>) -> prefetch_view<views::all_t<R>>;
+
+template <typename R, typename Proj>
+prefetch_view(R&&, range_difference_t<R>, Proj)
+    -> prefetch_view<views::all_t<R>, Proj>;
+
+template <forward_range V, typename Proj>
+requires view<V> && details::prefetch_projection<Proj, V>
+template <bool Const>
+class prefetch_view<V, Proj>::iterator {
+    using Parent RXX_NODEBUG = details::const_if<Const, prefetch_view>;
+    using Base RXX_NODEBUG = details::const_if<Const, V>;
+
+    friend prefetch_view;
+    template <bool>
+    friend class iterator;
+
+    static constexpr bool indexes_ahead =
+        details::prefetch_indexes_ahead<Base>;
+
+    struct at_end_t {};
+    static constexpr at_end_t at_end{};
+
+    using Ahead RXX_NODEBUG = std::conditional_t<indexes_ahead,
+        range_difference_t<Base>, iterator_t<Base>>;
+    using End RXX_NODEBUG = std::conditional_t<indexes_ahead,
+        details::empty_cache, sentinel_t<Base>>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(
+        Parent& parent, iterator_t<Base> current)
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(current)) {
+        auto& base = parent.base_;
+        if constexpr (indexes_ahead) {
+            ahead_ = ranges::end(base) - current_;
+        } else {
+            end_ = ranges::end(base);
+            ahead_ = current_;
+            lag_ = parent_->distance_ -
+                ranges::advance(ahead_, parent_->distance_, end_);
+        }
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(
+        Parent& parent, iterator_t<Base> last, at_end_t)
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(last)) {
+        if constexpr (!indexes_ahead) {
+            end_ = current_;
+            ahead_ = current_;
+        }
+    }
+
+    static consteval auto make_iterator_concept() noexcept {
+        if constexpr (indexes_ahead) {
+            return std::random_access_iterator_tag{};
+        } else if constexpr (bidirectional_range<Base>) {
+            return std::bidirectional_iterator_tag{};
+        } else {
+            return std::forward_iterator_tag{};
+        }
+    }
+
+    static consteval auto make_iterator_category() noexcept {
+        using Category = details::iterator_category_of<Const, V>;
+        if constexpr (!std::derived_from<Category,
+                          std::bidirectional_iterator_tag> ||
+            indexes_ahead) {
+            return Category{};
+        } else {
+            return std::bidirectional_iterator_tag{};
+        }
+    }
+
+public:
+    using iterator_concept = decltype(make_iterator_concept());
+    using iterator_category = decltype(make_iterator_category());
+    using value_type = range_value_t<Base>;
+    using difference_type = range_difference_t<Base>;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<Base>>) = default;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(iterator<!Const> other)
+    requires Const && std::convertible_to<iterator_t<V>, iterator_t<Base>> &&
+        std::convertible_to<sentinel_t<V>, sentinel_t<Base>>
+        : parent_(other.parent_)
+        , current_(__RXX move(other.current_))
+        , ahead_(__RXX move(other.ahead_))
+        , end_(__RXX move(other.end_))
+        , lag_(other.lag_) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<Base> const& base() const& noexcept {
+        return current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<Base> base() && { return __RXX move(current_); }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr range_reference_t<Base> operator*() const
+        noexcept(noexcept(*current_)) {
+        return *current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr decltype(auto) operator[](difference_type offset) const
+    requires indexes_ahead
+    {
+        return current_[offset];
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++current_;
+        if constexpr (indexes_ahead) {
+            // `ahead_` holds the number of elements left
+            if (--ahead_ > parent_->distance_) {
+                prefetch(current_[parent_->distance_]);
+            }
+        } else if (ahead_ == end_) {
+            --lag_;
+        } else if (++ahead_ != end_) {
+            prefetch(*ahead_);
+        }
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--()
+    requires bidirectional_range<Base>
+    {
+        --current_;
+        if constexpr (indexes_ahead) {
+            ++ahead_;
+        } else if (lag_ < parent_->distance_) {
+            ++lag_;
+        } else {
+            --ahead_;
+        }
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int)
+    requires bidirectional_range<Base>
+    {
+        auto previous = *this;
+        --*this;
+        return previous;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset)
+    requires indexes_ahead
+    {
+        current_ += offset;
+        ahead_ -= offset;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset)
+    requires indexes_ahead
+    {
+        current_ -= offset;
+        ahead_ += offset;
+        return *this;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(iterator iter, difference_type offset)
+    requires indexes_ahead
+    {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(difference_type offset, iterator iter)
+    requires indexes_ahead
+    {
+        iter += offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator-(iterator iter, difference_type offset)
+    requires indexes_ahead
+    {
+        iter -= offset;
+        return iter;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        iterator const& left, iterator const& right)
+    requires std::sized_sentinel_for<iterator_t<Base>, iterator_t<Base>>
+    {
+        return left.current_ - right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) {
+        return left.current_ == right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto operator<=>(
+        iterator const& left, iterator const& right)
+    requires indexes_ahead && std::three_way_comparable<iterator_t<Base>>
+    {
+        return left.current_ <=> right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_rvalue_reference_t<Base>
+    iter_move(iterator const& iter) noexcept(
+        noexcept(ranges::iter_move(iter.current_))) {
+        return ranges::iter_move(iter.current_);
+    }
+
+    __RXX_HIDE_FROM_ABI friend constexpr void
+    iter_swap(iterator const& left, iterator const& right) noexcept(
+        noexcept(ranges::iter_swap(left.current_, right.current_)))
+    requires std::indirectly_swappable<iterator_t<Base>>
+    {
+        ranges::iter_swap(left.current_, right.current_);
+    }
+
+private:
+    /** Projects the base reference as is, as `prefetch_projection` checks. */
+    template <typename E>
+    __RXX_HIDE_FROM_ABI constexpr void prefetch(E&& element) const {
+        details::prefetch_address(
+            std::invoke(*parent_->proj_, __RXX forward<E>(element)));
+    }
+
+    Parent* parent_ = nullptr;
+    iterator_t<Base> current_{};
+    /**
+     * The number of elements left when indexing ahead, otherwise the iterator
+     * `lag_` elements ahead of `current_`.
+     */
+    Ahead ahead_{};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) End end_ {};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS)
+    std::conditional_t<indexes_ahead, details::empty_cache, difference_type>
+        lag_ {};
+};
+
+template <forward_range V, typename Proj>
+requires view<V> && details::prefetch_projection<Proj, V>
+template <bool Const>
+class prefetch_view<V, Proj>::sentinel {
+    using Base RXX_NODEBUG = details::const_if<Const, V>;
+
+    friend prefetch_view;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr sentinel(
+        sentinel_t<Base> end) noexcept(std::
+            is_nothrow_move_constructible_v<sentinel_t<Base>>)
+        : end_(__RXX move(end)) {}
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr sentinel() noexcept(
+        std::is_nothrow_default_constructible_v<sentinel_t<Base>>) = default;
+
+    __RXX_HIDE_FROM_ABI constexpr sentinel(sentinel<!Const> other) noexcept(
+        std::is_nothrow_constructible_v<sentinel_t<Base>, sentinel_t<V>>)
+    requires Const && std::convertible_to<sentinel_t<V>, sentinel_t<Base>>
+        : end_(__RXX move(other.end_)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr sentinel_t<Base> base() const
+        noexcept(std::is_nothrow_copy_constructible_v<sentinel_t<Base>>) {
+        return end_;
+    }
+
+    template <bool OtherConst>
+    requires std::sentinel_for<sentinel_t<Base>,
+        iterator_t<details::const_if<OtherConst, V>>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator<OtherConst> const& iter, sentinel const& self) {
+        return iter.base() == self.end_;
+    }
+
+    template <bool OtherConst>
+    requires std::sized_sentinel_for<sentinel_t<Base>,
+        iterator_t<details::const_if<OtherConst, V>>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_difference_t<details::const_if<OtherConst, V>>
+    operator-(iterator<OtherConst> const& iter, sentinel const& self) {
+        return iter.base() - self.end_;
+    }
+
+    template <bool OtherConst>
+    requires std::sized_sentinel_for<sentinel_t<Base>,
+        iterator_t<details::const_if<OtherConst, V>>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr range_difference_t<details::const_if<OtherConst, V>>
+    operator-(sentinel const& self, iterator<OtherConst> const& iter) {
+        return self.end_ - iter.base();
+    }
+
+private:
+    sentinel_t<Base> end_{};
+};
+
+namespace views {
+namespace details {
+struct prefetch_t : ranges::details::adaptor_non_closure<prefetch_t> {
+
+    template <viewable_range R, typename D = range_difference_t<R>>
+    requires requires { prefetch_view(std::declval<R>(), std::declval<D>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& arg, std::type_identity_t<D> distance) RXX_CONST_CALL
+        noexcept(noexcept(
+            prefetch_view(std::declval<R>(), std::declval<D>()))) {
+        return prefetch_view(__RXX forward<R>(arg), distance);
+    }
+
+    template <viewable_range R, typename D = range_difference_t<R>,
+        typename Proj>
+    requires requires {
+        prefetch_view(
+            std::declval<R>(), std::declval<D>(), std::declval<Proj>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg,
+        std::type_identity_t<D> distance, Proj&& proj) RXX_CONST_CALL
+        noexcept(noexcept(prefetch_view(std::declval<R>(), std::declval<D>(),
+            std::declval<Proj>()))) {
+        return prefetch_view(
+            __RXX forward<R>(arg), distance, __RXX forward<Proj>(proj));
+    }
+
+    template <typename D>
+    requires (!viewable_range<D>) && std::constructible_from<std::decay_t<D>, D>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(D&& distance) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<D>, D>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<2>(prefetch_t{}),
+            __RXX forward<D>(distance));
+    }
+
+    template <typename D, typename Proj>
+    requires (!viewable_range<D>) &&
+        std::constructible_from<std::decay_t<D>, D> &&
+        std::constructible_from<std::decay_t<Proj>, Proj>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        D&& distance, Proj&& proj) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<D>, D> &&
+            std::is_nothrow_constructible_v<std::decay_t<Proj>, Proj>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<3>(prefetch_t{}),
+            __RXX forward<D>(distance), __RXX forward<Proj>(proj));
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::prefetch_t prefetch{};
+}
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
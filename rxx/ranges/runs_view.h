@@ -0,0 +1,206 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/non_propagating_cache.h"
+#include "rxx/details/run_boundary.h"
+#include "rxx/functional/equal_to.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/tuple.h"
+#include "rxx/utility.h"
+
+#include <memory>
+#include <type_traits>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Run-length encodes a range, yielding each maximal run of equal elements
+ * as its first element and its length. Runs of contiguous scalars are
+ * measured with a blocked scan rather than one comparison per step.
+ */
+template <forward_range V>
+requires view<V> &&
+    std::indirectly_comparable<iterator_t<V>, iterator_t<V>, equal_to>
+class runs_view : public view_interface<runs_view<V>> {
+    struct run {
+        iterator_t<V> next;
+        range_difference_t<V> count;
+    };
+
+    class iterator;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr runs_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr runs_view(V base) noexcept(
+        std::is_nothrow_move_constructible_v<V>)
+        : base_(__RXX move(base)) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator begin() {
+        auto first = __RXX ranges::begin(base_);
+        if (!cached_begin_) {
+            cached_begin_.emplace(find_next(first));
+        }
+
+        return iterator{*this, __RXX move(first), *cached_begin_};
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr auto end() {
+        if constexpr (common_range<V>) {
+            return iterator{
+                *this, ranges::end(base_), run{ranges::end(base_), 0}};
+        } else {
+            return std::default_sentinel;
+        }
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr run find_next(iterator_t<V> const& current) {
+        using T = range_value_t<V>;
+        if constexpr (contiguous_range<V> && sized_range<V> &&
+            details::run_scalar<T>) {
+            auto const* const first = std::to_address(current);
+            auto const* const last =
+                ranges::data(base_) + ranges::size(base_);
+            if (first == last) {
+                return run{current, 0};
+            }
+
+            auto const count =
+                details::find_run_end<T>(first + 1, last, *first) - first;
+            return run{current + count, count};
+        } else {
+            auto const last = ranges::end(base_);
+            auto next = current;
+            range_difference_t<V> count = 0;
+            if (next != last) {
+                do {
+                    ++next;
+                    ++count;
+                } while (next != last && equal_to{}(*next, *current));
+            }
+
+            return run{__RXX move(next), count};
+        }
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    details::non_propagating_cache<run> cached_begin_;
+};
+
+template <typename R>
+runs_view(R&&) -> runs_view<views::all_t<R>>;
+
+template <forward_range V>
+requires view<V> &&
+    std::indirectly_comparable<iterator_t<V>, iterator_t<V>, equal_to>
+class runs_view<V>::iterator {
+    friend runs_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(runs_view& parent,
+        iterator_t<V> current,
+        run next) noexcept(std::is_nothrow_move_constructible_v<iterator_t<V>>)
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(current))
+        , next_(__RXX move(next.next))
+        , count_(next.count) {}
+
+public:
+    using value_type = tuple<range_value_t<V>, range_difference_t<V>>;
+    using difference_type = range_difference_t<V>;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept(
+        std::is_nothrow_default_constructible_v<iterator_t<V>>) = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr tuple<range_reference_t<V>, difference_type> operator*() const {
+        return tuple<range_reference_t<V>, difference_type>{*current_, count_};
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        current_ = next_;
+        auto next = parent_->find_next(current_);
+        next_ = __RXX move(next.next);
+        count_ = next.count;
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) {
+        return left.current_ == right.current_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& iter, std::default_sentinel_t) {
+        return iter.current_ == iter.next_;
+    }
+
+private:
+    runs_view* parent_ = nullptr;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) iterator_t<V> current_ {};
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) iterator_t<V> next_ {};
+    difference_type count_ = 0;
+};
+
+namespace views {
+namespace details {
+struct runs_t : __RXX ranges::details::adaptor_closure<runs_t> {
+
+    template <viewable_range R>
+    requires requires { runs_view(std::declval<R>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg) RXX_CONST_CALL
+        noexcept(noexcept(runs_view(std::declval<R>()))) {
+        return runs_view(__RXX forward<R>(arg));
+    }
+
+#if RXX_LIBSTDCXX
+    static constexpr bool _S_has_simple_call_op = true;
+#endif
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::runs_t runs{};
+} // namespace cpo
+} // namespace views
+
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
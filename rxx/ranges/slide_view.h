@@ -144,6 +144,32 @@ public:
         }
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        auto const hint =
+            static_cast<range_difference_t<V>>(ranges::reserve_hint(base_));
+        if (auto const value = hint - num_ + 1; value >= 0) {
+            return details::to_unsigned_like(value);
+        } else {
+            return details::to_unsigned_like(static_cast<decltype(value)>(0));
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        auto const hint =
+            static_cast<range_difference_t<V>>(ranges::reserve_hint(base_));
+        if (auto const value = hint - num_ + 1; value >= 0) {
+            return details::to_unsigned_like(value);
+        } else {
+            return details::to_unsigned_like(static_cast<decltype(value)>(0));
+        }
+    }
+
 private:
     using CacheBegin RXX_NODEBUG =
         std::conditional_t<details::slide_caches_first<V>,
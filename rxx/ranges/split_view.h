@@ -3,16 +3,230 @@
 
 #include "rxx/config.h"
 
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/details/cached_position.h"
+#include "rxx/details/find_delimiter.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/lazy_split_view.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/subrange.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/utility.h"
+
+#include <memory>
 #include <ranges>
+#include <type_traits>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
 using std::ranges::split_view;
 
+/**
+ * Splits contiguous bytes on a single delimiter, finding each delimiter
+ * with memchr. Behaves as a `split_view` with a one element pattern,
+ * yielding contiguous subranges of the base, which convert to
+ * `std::string_view` for character data.
+ */
+template <contiguous_range V>
+requires view<V> && sized_range<V> && common_range<V> &&
+    details::byte_like<range_value_t<V>>
+class byte_split_view : public view_interface<byte_split_view<V>> {
+    using Delimiter RXX_NODEBUG = range_value_t<V>;
+
+    class iterator;
+
+public:
+    __RXX_HIDE_FROM_ABI constexpr byte_split_view() noexcept(
+        std::is_nothrow_default_constructible_v<V>)
+    requires std::default_initializable<V>
+    = default;
+
+    __RXX_HIDE_FROM_ABI constexpr byte_split_view(V base,
+        Delimiter delimiter) noexcept(std::is_nothrow_move_constructible_v<V>)
+        : base_(__RXX move(base))
+        , delimiter_(delimiter) {}
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() const& noexcept(std::is_nothrow_copy_constructible_v<V>)
+    requires std::copy_constructible<V>
+    {
+        return base_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr V base() && noexcept(std::is_nothrow_move_constructible_v<V>) {
+        return __RXX move(base_);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr Delimiter delimiter() const noexcept { return delimiter_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator begin() {
+        auto first = __RXX ranges::begin(base_);
+        if (!cached_begin_) {
+            cached_begin_.set(base_, find_next(first));
+        }
+
+        return iterator{*this, __RXX move(first), cached_begin_.get(base_)};
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD) constexpr iterator end() {
+        return iterator{*this, ranges::end(base_), ranges::end(base_)};
+    }
+
+private:
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> find_next(iterator_t<V> current) {
+        auto const* const first = std::to_address(current);
+        auto const* const last = ranges::data(base_) + ranges::size(base_);
+        return current +
+            (details::find_delimiter<Delimiter>(first, last, delimiter_) -
+                first);
+    }
+
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) V base_ {};
+    Delimiter delimiter_{};
+    details::cached_position<V> cached_begin_;
+};
+
+template <typename R>
+byte_split_view(R&&, range_value_t<R>) -> byte_split_view<views::all_t<R>>;
+
+template <contiguous_range V>
+requires view<V> && sized_range<V> && common_range<V> &&
+    details::byte_like<range_value_t<V>>
+class byte_split_view<V>::iterator {
+    friend byte_split_view;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(byte_split_view& parent,
+        iterator_t<V> current, iterator_t<V> next) noexcept
+        : parent_(RXX_BUILTIN_addressof(parent))
+        , current_(__RXX move(current))
+        , next_(__RXX move(next)) {}
+
+public:
+    using value_type = subrange<iterator_t<V>>;
+    using difference_type = range_difference_t<V>;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept = default;
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr iterator_t<V> base() const noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr value_type operator*() const noexcept {
+        return value_type{current_, next_};
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        auto const last = ranges::end(parent_->base_);
+        current_ = next_;
+        if (current_ == last) {
+            trailing_empty_ = false;
+            return *this;
+        }
+
+        ++current_;
+        if (current_ == last) {
+            trailing_empty_ = true;
+            next_ = current_;
+        } else {
+            next_ = parent_->find_next(current_);
+        }
+
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) noexcept {
+        return left.current_ == right.current_ &&
+            left.trailing_empty_ == right.trailing_empty_;
+    }
+
+private:
+    byte_split_view* parent_ = nullptr;
+    iterator_t<V> current_{};
+    iterator_t<V> next_{};
+    bool trailing_empty_ = false;
+};
+
 namespace views {
+namespace details {
+
+template <typename R, typename P>
+concept splitting_on_byte_element = viewable_range<R> &&
+    contiguous_range<R> && sized_range<R> && common_range<views::all_t<R>> &&
+    __RXX ranges::details::byte_like<range_value_t<R>> &&
+    std::same_as<std::remove_cvref_t<P>, range_value_t<R>>;
+
+template <typename R, typename P>
+concept splitting_on_byte_pattern = viewable_range<R> &&
+    contiguous_range<R> && sized_range<R> && common_range<views::all_t<R>> &&
+    __RXX ranges::details::byte_like<range_value_t<R>> &&
+    forward_range<std::remove_cvref_t<P>> &&
+    __RXX ranges::details::tiny_range<std::remove_cvref_t<P>> &&
+    std::remove_cvref_t<P>::size() == 1 &&
+    std::same_as<range_value_t<std::remove_cvref_t<P>>, range_value_t<R>>;
+
+struct split_t : ranges::details::adaptor_non_closure<split_t> {
+
+    template <typename R, typename P>
+    requires (!splitting_on_byte_element<R, P> &&
+                 !splitting_on_byte_pattern<R, P>) &&
+        requires { std::views::split(std::declval<R>(), std::declval<P>()); }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& range, P&& pattern) RXX_CONST_CALL
+        noexcept(noexcept(
+            std::views::split(std::declval<R>(), std::declval<P>()))) {
+        return std::views::split(
+            __RXX forward<R>(range), __RXX forward<P>(pattern));
+    }
+
+    template <typename R, typename P>
+    requires splitting_on_byte_element<R, P>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& range, P&& delimiter) RXX_CONST_CALL {
+        return byte_split_view(__RXX forward<R>(range), delimiter);
+    }
+
+    template <typename R, typename P>
+    requires splitting_on_byte_pattern<R, P>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        R&& range, P&& pattern) RXX_CONST_CALL {
+        return byte_split_view(
+            __RXX forward<R>(range), *ranges::begin(pattern));
+    }
+
+    template <typename P>
+    requires std::constructible_from<std::decay_t<P>, P>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(P&& pattern) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<P>, P>) {
+        return __RXX ranges::details::make_pipeable(
+            __RXX ranges::details::set_arity<2>(split_t{}),
+            __RXX forward<P>(pattern));
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-inline constexpr std::decay_t<decltype(std::views::split)> split{};
+inline constexpr details::split_t split{};
 }
 } // namespace views
 } // namespace ranges
@@ -118,6 +118,24 @@ public:
             details::ceil_div(ranges::distance(base_), stride_));
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<V>
+    {
+        auto const hint =
+            static_cast<range_difference_t<V>>(ranges::reserve_hint(base_));
+        return details::to_unsigned_like(details::ceil_div(hint, stride_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<V const>
+    {
+        auto const hint =
+            static_cast<range_difference_t<V>>(ranges::reserve_hint(base_));
+        return details::to_unsigned_like(details::ceil_div(hint, stride_));
+    }
+
 private:
     V base_;
     range_difference_t<V> stride_;
@@ -72,6 +72,23 @@ concept taking_repeat = takeable<V, N> && !taking_empty<V, N> &&
     __RXX ranges::details::is_repeat_view_like<std::remove_cvref_t<V>> &&
     requires { take(std::declval<V>(), std::declval<N>()); };
 
+template <typename R>
+inline constexpr bool is_take_view = false;
+
+template <typename V>
+inline constexpr bool is_take_view<take_view<V>> = true;
+
+/**
+ * A sized `take_view`: its size is the count it takes, so a further take
+ * narrows it rather than stacking another.
+ */
+template <typename V, typename N>
+concept taking_take_view = takeable<V, N> && !taking_empty<V, N> &&
+    !taking_optional<V, N> && !taking_random_sized_range<V, N> &&
+    is_take_view<std::remove_cvref_t<V>> &&
+    sized_range<std::remove_cvref_t<V>> &&
+    requires(V&& view) { __RXX forward<V>(view).base(); };
+
 struct take_t : ranges::details::adaptor_non_closure<take_t> {
 
     template <viewable_range V, typename N = range_difference_t<V>>
@@ -122,10 +139,20 @@ struct take_t : ranges::details::adaptor_non_closure<take_t> {
         return take(__RXX forward<V>(view), __RXX forward<N>(num));
     }
 
+    template <viewable_range V, typename N = range_difference_t<V>>
+    requires taking_take_view<V, N>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        V&& view, std::type_identity_t<N> num) RXX_CONST_CALL {
+        auto const taken = ranges::distance(view);
+        return take_t{}(__RXX forward<V>(view).base(), std::min<N>(taken, num));
+    }
+
     template <viewable_range V, typename N = range_difference_t<V>>
     requires takeable<V, N> &&
         (!(taking_empty<V, N> || taking_optional<V, N> ||
-            taking_random_sized_range<V, N> || taking_repeat<V, N>))
+            taking_random_sized_range<V, N> || taking_repeat<V, N> ||
+            taking_take_view<V, N>))
     RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
     RXX_STATIC_CALL constexpr decltype(auto)
     operator()(V&& view, std::type_identity_t<N> num) RXX_CONST_CALL noexcept(
@@ -0,0 +1,379 @@
+// Copyright 2025 Bryan Wong
+#pragma once
+
+#include "rxx/config.h"
+
+#include "rxx/details/const_if.h"
+#include "rxx/details/simple_view.h"
+#include "rxx/details/to_unsigned_like.h"
+#include "rxx/iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/all.h"
+#include "rxx/ranges/cartesian_product_view.h"
+#include "rxx/ranges/concepts.h"
+#include "rxx/ranges/get_element.h"
+#include "rxx/ranges/primitives.h"
+#include "rxx/ranges/view_interface.h"
+#include "rxx/tuple.h"
+#include "rxx/utility.h"
+
+#include <array>
+#include <cassert>
+#include <compare>
+
+RXX_DEFAULT_NAMESPACE_BEGIN
+
+namespace ranges {
+
+/**
+ * Visits the cartesian product of random access ranges tile by tile: the
+ * product space is cut into blocks of `tiles()` elements per dimension,
+ * the blocks are visited in row-major order and so are the elements of
+ * each block. Consecutive elements then reuse the same few rows of every
+ * base, which keeps all-pairs style loops over large ranges in cache.
+ *
+ * Within a tile the iterator only steps and compares its coordinates; the
+ * position of the next tile is worked out once per tile.
+ */
+template <details::sized_random_access_range... Vs>
+requires (sizeof...(Vs) > 0) && (... && view<Vs>)
+class tiled_cartesian_product_view :
+    public view_interface<tiled_cartesian_product_view<Vs...>> {
+    template <bool>
+    class iterator;
+
+public:
+    using difference_type =
+        std::common_type_t<ptrdiff_t, range_difference_t<Vs>...>;
+    using tiles_type = std::array<difference_type, sizeof...(Vs)>;
+
+    __RXX_HIDE_FROM_ABI constexpr tiled_cartesian_product_view() noexcept(
+        (... && std::is_nothrow_default_constructible_v<Vs>))
+    requires (... && std::default_initializable<Vs>)
+    = default;
+
+    __RXX_HIDE_FROM_ABI explicit constexpr tiled_cartesian_product_view(
+        tiles_type tiles,
+        Vs... bases) noexcept((... && std::is_nothrow_move_constructible_v<Vs>))
+        : bases_{__RXX move(bases)...}
+        , tiles_{tiles} {
+        for (auto const tile : tiles_) {
+            assert(tile > 0);
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr tiles_type tiles() const noexcept { return tiles_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin()
+    requires (... || !details::simple_view<Vs>)
+    {
+        return iterator<false>(*this, 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto begin() const
+    requires (... && details::sized_random_access_range<Vs const>)
+    {
+        return iterator<true>(*this, 0);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end()
+    requires (... || !details::simple_view<Vs>)
+    {
+        return iterator<false>(*this, total(bases_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto end() const
+    requires (... && details::sized_random_access_range<Vs const>)
+    {
+        return iterator<true>(*this, total(bases_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() {
+        return details::to_unsigned_like(total(bases_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto size() const
+    requires (... && sized_range<Vs const>)
+    {
+        return details::to_unsigned_like(total(bases_));
+    }
+
+private:
+    template <typename Bases>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr difference_type total(Bases& bases) {
+        return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+            return (difference_type(1) * ... *
+                static_cast<difference_type>(
+                    ranges::size(get_element<Is>(bases))));
+        }(__RXX make_index_sequence_v<sizeof...(Vs)>);
+    }
+
+    tuple<Vs...> bases_;
+    tiles_type tiles_{};
+};
+
+template <details::sized_random_access_range... Vs>
+requires (sizeof...(Vs) > 0) && (... && view<Vs>)
+template <bool Const>
+class tiled_cartesian_product_view<Vs...>::iterator {
+    friend tiled_cartesian_product_view;
+    using Parent = details::const_if<Const, tiled_cartesian_product_view>;
+    using coordinates RXX_NODEBUG = tiles_type;
+    static constexpr size_t rank = sizeof...(Vs);
+
+    __RXX_HIDE_FROM_ABI static constexpr decltype(auto) get_parent_bases(
+        iterator const& iter) noexcept {
+        return iter.parent_->bases_;
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = tuple<range_value_t<details::const_if<Const, Vs>>...>;
+    using reference =
+        tuple<range_reference_t<details::const_if<Const, Vs>>...>;
+    using difference_type =
+        typename tiled_cartesian_product_view::difference_type;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator() noexcept = default;
+
+    __RXX_HIDE_FROM_ABI constexpr iterator(iterator<!Const> other) noexcept
+    requires Const
+        : parent_{other.parent_}
+        , position_{other.position_}
+        , current_{other.current_}
+        , tile_first_{other.tile_first_}
+        , tile_last_{other.tile_last_} {}
+
+    /** The position of the current element in each base. */
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr coordinates const& indices() const noexcept { return current_; }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr reference operator*() const {
+        return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+            return reference{
+                ranges::begin(get_element<Is>(parent_->bases_))[static_cast<
+                    range_difference_t<details::const_if<Const, Vs>>>(
+                    current_[Is])]...};
+        }(__RXX make_index_sequence_v<rank>);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr reference operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator++() {
+        ++position_;
+        for (size_t idx = rank; idx-- != 0;) {
+            if (++current_[idx] != tile_last_[idx]) {
+                return *this;
+            }
+
+            current_[idx] = tile_first_[idx];
+        }
+
+        seek(position_);
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator++(int) {
+        auto prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator--() {
+        --position_;
+        for (size_t idx = rank; idx-- != 0;) {
+            if (current_[idx] != tile_first_[idx] &&
+                tile_first_[idx] != tile_last_[idx]) {
+                --current_[idx];
+                return *this;
+            }
+
+            current_[idx] = tile_last_[idx] - 1;
+        }
+
+        seek(position_);
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator operator--(int) {
+        auto prev = *this;
+        --*this;
+        return prev;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator+=(difference_type offset) {
+        if (offset != 0) {
+            seek(position_ + offset);
+        }
+
+        return *this;
+    }
+
+    __RXX_HIDE_FROM_ABI constexpr iterator& operator-=(difference_type offset) {
+        return *this += -offset;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(iterator iter, difference_type offset) {
+        return iter += offset;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator+(difference_type offset, iterator iter) {
+        return iter += offset;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr iterator operator-(iterator iter, difference_type offset) {
+        return iter -= offset;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr difference_type operator-(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ - right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr bool operator==(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ == right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr std::strong_ordering operator<=>(
+        iterator const& left, iterator const& right) noexcept {
+        return left.position_ <=> right.position_;
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    friend constexpr auto iter_move(iterator const& iter) {
+        return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+            return tuple<range_rvalue_reference_t<
+                details::const_if<Const, Vs>>...>{
+                ranges::iter_move(ranges::begin(get_element<Is>(
+                                      get_parent_bases(iter))) +
+                    static_cast<range_difference_t<
+                        details::const_if<Const, Vs>>>(iter.current_[Is]))...};
+        }(__RXX make_index_sequence_v<rank>);
+    }
+
+private:
+    __RXX_HIDE_FROM_ABI constexpr iterator(
+        Parent& parent, difference_type position)
+        : parent_{RXX_BUILTIN_addressof(parent)} {
+        seek(position);
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr coordinates sizes() const {
+        return [&]<size_t... Is>(__RXX index_sequence<Is...>) {
+            return coordinates{static_cast<difference_type>(
+                ranges::size(get_element<Is>(parent_->bases_)))...};
+        }(__RXX make_index_sequence_v<rank>);
+    }
+
+    /**
+     * Moves to the element visited `position`-th. Each dimension in turn
+     * selects the slab of whole tiles the position falls into, whose height
+     * is clipped at the end of the base; the rest of the position is then
+     * the row-major offset within the tile found.
+     */
+    __RXX_HIDE_FROM_ABI constexpr void seek(difference_type position) {
+        position_ = position;
+        auto const size = sizes();
+        auto const& tiles = parent_->tiles_;
+        difference_type const total = product(size);
+        if (position == total) {
+            current_ = coordinates{};
+            current_[0] = size[0];
+            tile_first_ = current_;
+            tile_last_ = current_;
+            return;
+        }
+
+        assert(position >= 0 && position < total);
+        difference_type inner = 1;
+        for (size_t idx = 1; idx != rank; ++idx) {
+            inner *= size[idx];
+        }
+
+        difference_type height = 1;
+        for (size_t idx = 0; idx != rank; ++idx) {
+            auto const slab = height * tiles[idx] * inner;
+            auto const tile = position / slab;
+            position %= slab;
+            tile_first_[idx] = tile * tiles[idx];
+            tile_last_[idx] = tile_first_[idx] + tiles[idx] < size[idx]
+                ? tile_first_[idx] + tiles[idx]
+                : size[idx];
+            height *= tile_last_[idx] - tile_first_[idx];
+            if (idx + 1 != rank) {
+                inner /= size[idx + 1];
+            }
+        }
+
+        for (size_t idx = rank; idx-- != 0;) {
+            auto const extent = tile_last_[idx] - tile_first_[idx];
+            current_[idx] = tile_first_[idx] + position % extent;
+            position /= extent;
+        }
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr difference_type product(
+        coordinates const& size) noexcept {
+        difference_type result = 1;
+        for (auto const extent : size) {
+            result *= extent;
+        }
+        return result;
+    }
+
+    Parent* parent_ = nullptr;
+    difference_type position_ = 0;
+    coordinates current_{};
+    coordinates tile_first_{};
+    coordinates tile_last_{};
+};
+
+namespace views {
+namespace details {
+struct cartesian_product_tiled_t {
+    template <typename... Rs>
+    requires (sizeof...(Rs) > 0) && requires {
+        tiled_cartesian_product_view<all_t<Rs>...>(
+            std::declval<typename tiled_cartesian_product_view<
+                all_t<Rs>...>::tiles_type>(),
+            std::declval<Rs>()...);
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(
+        typename tiled_cartesian_product_view<all_t<Rs>...>::tiles_type tiles,
+        Rs&&... args) RXX_CONST_CALL {
+        return tiled_cartesian_product_view<all_t<Rs>...>(
+            tiles, __RXX forward<Rs>(args)...);
+    }
+};
+} // namespace details
+
+inline namespace cpo {
+inline constexpr details::cartesian_product_tiled_t cartesian_product_tiled{};
+}
+} // namespace views
+} // namespace ranges
+
+RXX_DEFAULT_NAMESPACE_END
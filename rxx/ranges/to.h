@@ -4,11 +4,18 @@
 #include "rxx/config.h"
 
 #include "rxx/details/adaptor_closure.h"
+#include "rxx/details/view_traits.h"
 #include "rxx/functional/bind_back.h"
+#include "rxx/iterator/for_each_while.h"
+#include "rxx/iterator/segmented_iterator.h"
+#include "rxx/ranges/access.h"
+#include "rxx/ranges/as_rvalue_view.h"
 #include "rxx/ranges/concepts.h"
 #include "rxx/ranges/from_range.h"
+#include "rxx/ranges/owning_view.h"
 #include "rxx/ranges/primitives.h"
 #include "rxx/ranges/ref_view.h"
+#include "rxx/ranges/subrange.h"
 #include "rxx/ranges/transform_view.h"
 #include "rxx/utility.h"
 
@@ -26,12 +33,56 @@ constexpr bool reservable_container = sized_range<Container> &&
         { container.max_size() } -> std::same_as<decltype(size)>;
     };
 
+/**
+ * Hash containers size their bucket array with `reserve` but, unlike
+ * sequence containers, have no `capacity` to report it.
+ */
+template <typename Container>
+constexpr bool hash_reservable_container = sized_range<Container> &&
+    requires(Container& container, range_size_t<Container> size) {
+        container.reserve(size);
+        container.bucket_count();
+        container.max_load_factor();
+    };
+
+template <typename Container>
+constexpr bool presizable_container = reservable_container<Container> ||
+    hash_reservable_container<Container>;
+
+/**
+ * Sources whose elements can be copied into the container as one block of
+ * bytes once they are handed over as a pair of pointers.
+ */
+template <typename Range, typename Container>
+concept bulk_copyable_range = input_range<Container> &&
+    contiguous_range<Range> && sized_range<Range> &&
+    std::same_as<std::remove_cvref_t<range_reference_t<Range>>,
+        range_value_t<Container>> &&
+    std::is_trivially_copyable_v<range_value_t<Container>>;
+
+template <typename Container, typename Range, typename... Args>
+concept bulk_constructible = bulk_copyable_range<Range, Container> &&
+    std::constructible_from<Container,
+        std::add_pointer_t<range_reference_t<Range>>,
+        std::add_pointer_t<range_reference_t<Range>>, Args...>;
+
+template <typename Container, typename Range>
+concept bulk_insertable = bulk_copyable_range<Range, Container> &&
+    requires(Container& container,
+        std::add_pointer_t<range_reference_t<Range>> ptr) {
+        container.insert(container.end(), ptr, ptr);
+    };
+
 template <typename Container, typename Ref>
 constexpr bool container_appendable =
     requires(Container& container, Ref&& ref) {
         requires (
             requires { container.emplace_back(__RXX forward<Ref>(ref)); } ||
             requires { container.push_back(__RXX forward<Ref>(ref)); } ||
+            requires {
+                container.emplace_hint(
+                    container.end(), __RXX forward<Ref>(ref));
+            } ||
             requires {
                 container.emplace(container.end(), __RXX forward<Ref>(ref));
             } ||
@@ -40,6 +91,218 @@ constexpr bool container_appendable =
             });
     };
 
+template <typename Container, typename Ref>
+__RXX_HIDE_FROM_ABI constexpr void container_append(
+    Container& container, Ref&& ref) {
+    if constexpr ( //
+        requires { container.emplace_back(std::declval<Ref>()); }) {
+        container.emplace_back(__RXX forward<Ref>(ref));
+    } else if constexpr ( //
+        requires { container.push_back(std::declval<Ref>()); }) {
+        container.push_back(__RXX forward<Ref>(ref));
+    } else if constexpr ( //
+        requires {
+            container.emplace_hint(container.end(), std::declval<Ref>());
+        }) {
+        // The unconstrained `emplace(args...)` of associative containers
+        // would otherwise be picked up and fail inside its body
+        container.emplace_hint(container.end(), __RXX forward<Ref>(ref));
+    } else if constexpr ( //
+        requires {
+            container.emplace(container.end(), std::declval<Ref>());
+        }) {
+        container.emplace(container.end(), __RXX forward<Ref>(ref));
+    } else {
+        static_assert(requires {
+            container.insert(container.end(), std::declval<Ref>());
+        });
+        container.insert(container.end(), __RXX forward<Ref>(ref));
+    }
+}
+
+/**
+ * Appends the whole of `range`, preferring the container's own bulk
+ * insertion, then a single pointer-pair insert for trivially copyable
+ * contiguous sources, and finally one element at a time.
+ */
+template <typename Container, typename R>
+__RXX_HIDE_FROM_ABI constexpr void container_append_range(
+    Container& container, R&& range) {
+    if constexpr ( //
+        requires { container.append_range(__RXX forward<R>(range)); }) {
+        container.append_range(__RXX forward<R>(range));
+    } else if constexpr ( //
+        requires {
+            container.insert_range(container.end(), __RXX forward<R>(range));
+        }) {
+        container.insert_range(container.end(), __RXX forward<R>(range));
+    } else if constexpr ( //
+        requires { container.insert_range(__RXX forward<R>(range)); }) {
+        container.insert_range(__RXX forward<R>(range));
+    } else if constexpr (bulk_insertable<Container, R>) {
+        auto const first = ranges::data(range);
+        container.insert(container.end(), first, first + ranges::size(range));
+    } else {
+        ranges::for_each_while(ranges::begin(range), ranges::end(range),
+            [&]<typename RefType>(RefType&& ref) {
+                container_append(container, __RXX forward<RefType>(ref));
+                return true;
+            });
+    }
+}
+
+/** The container held by a view that owns it outright, if any. */
+template <typename View>
+struct owned_container {};
+
+template <typename Container>
+struct owned_container<owning_view<Container>> {
+    using type = Container;
+
+    __RXX_HIDE_FROM_ABI static constexpr Container release(
+        owning_view<Container>&& view) {
+        return __RXX move(view).base();
+    }
+};
+
+template <typename View>
+requires requires { typename owned_container<View>::type; }
+struct owned_container<as_rvalue_view<View>> {
+    using type = typename owned_container<View>::type;
+
+    __RXX_HIDE_FROM_ABI static constexpr type release(
+        as_rvalue_view<View>&& view) {
+        return owned_container<View>::release(__RXX move(view).base());
+    }
+};
+
+template <typename Range>
+using owned_container_t =
+    typename owned_container<std::remove_reference_t<Range>>::type;
+
+/**
+ * An expiring view over a container that can be handed to the target as a
+ * whole, either because it is the target type or because the target can
+ * adopt its buffer, rather than being rebuilt one element at a time.
+ */
+template <typename Container, typename Range, typename... Args>
+concept adoptable_container = !std::is_lvalue_reference_v<Range> &&
+    requires { typename owned_container_t<Range>; } &&
+    std::constructible_from<Container, owned_container_t<Range>, Args...> &&
+    (std::same_as<Container, owned_container_t<Range>> ||
+        (input_range<Container> &&
+            std::same_as<range_value_t<owned_container_t<Range>>,
+                range_value_t<Container>>));
+
+/**
+ * An expiring range that owns its elements, either a container or an owning
+ * view, so that a recursive conversion can move each inner range out of it
+ * and adopt inner containers in turn.
+ */
+template <typename Range>
+concept expiring_owner = !std::is_lvalue_reference_v<Range> &&
+    std::is_lvalue_reference_v<range_reference_t<Range>> &&
+    (!view<std::remove_cvref_t<Range>> ||
+        requires { typename owned_container_t<Range>; });
+
+/**
+ * A range made of segments, such as a `join_with_view`, which is better
+ * appended one segment at a time, letting each segment take the bulk path
+ * of `container_append_range`, than through its composite iterator.
+ */
+template <typename Container, typename Range, typename... Args>
+concept segment_appendable = forward_range<Range> &&
+    segmented_iterator<iterator_t<Range>, sentinel_t<Range>> &&
+    std::constructible_from<Container, Args...> &&
+    container_appendable<Container, range_reference_t<Range>>;
+
+template <typename Container, typename Range>
+__RXX_HIDE_FROM_ABI constexpr void append_segments(
+    Container& container, Range&& range) {
+    ranges::for_each_segment(ranges::begin(range), ranges::end(range),
+        [&]<typename I, typename S>(I first, S last) -> I {
+            if constexpr (std::same_as<I, S>) {
+                container_append_range(container, subrange(first, last));
+                return last;
+            } else {
+                auto end = ranges::next(first, last);
+                container_append_range(container, subrange(first, end));
+                return end;
+            }
+        });
+}
+
+/**
+ * Adds up the sizes of the segments of a forward segmented range in one walk
+ * over the segment bounds, without touching any element. Returns false if a
+ * segment cannot tell its size in constant time.
+ */
+template <typename Size, typename Range>
+__RXX_HIDE_FROM_ABI constexpr bool sum_segment_sizes(
+    Range& range, Size& total) {
+    bool sized = true;
+    ranges::for_each_segment(ranges::begin(range), ranges::end(range),
+        [&]<typename I, typename S>(I first, S last) -> I {
+            if constexpr (std::sized_sentinel_for<S, I> &&
+                (std::same_as<I, S> || std::random_access_iterator<I>)) {
+                auto const length = last - first;
+                total += static_cast<Size>(length);
+                return first + length;
+            } else {
+                sized = first == last;
+                return first;
+            }
+        });
+    return sized;
+}
+
+/** A sized repeat of one value, built as the container's `(count, value)`. */
+template <typename Container, typename Range, typename... Args>
+concept repeat_fillable = is_repeat_view_like<std::remove_cvref_t<Range>> &&
+    sized_range<Range> && input_range<Container> &&
+    std::same_as<range_value_t<Container>, range_value_t<Range>> &&
+    std::constructible_from<Container, range_size_t<Container>,
+        range_reference_t<Range>, Args...>;
+
+/**
+ * A sized integer sequence, written into a contiguous container sized up
+ * front. Its iterators only claim to be input iterators to the library, so
+ * an iterator pair constructor would grow the container one element at a
+ * time.
+ */
+template <typename Container, typename Range, typename... Args>
+concept iota_fillable = is_iota_view_like<std::remove_cvref_t<Range>> &&
+    sized_range<Range> && std::integral<range_value_t<Range>> &&
+    contiguous_range<Container> &&
+    std::same_as<range_value_t<Container>, range_value_t<Range>> &&
+    std::constructible_from<Container, Args...> &&
+    requires(Container& container, range_size_t<Container> size) {
+        container.resize(size);
+    };
+
+/**
+ * Writes `value, value + 1, ...` to `out[0, size)`, a block at a time so the
+ * stores vectorize. The sums are unsigned, so no step can overflow.
+ */
+template <std::integral T>
+__RXX_HIDE_FROM_ABI constexpr void fill_iota(
+    T* out, size_t size, T value) noexcept {
+    using U = std::make_unsigned_t<T>;
+    constexpr size_t block = 64 / sizeof(T);
+    auto const start = static_cast<U>(value);
+    size_t idx = 0;
+    for (; size - idx >= block; idx += block) {
+        for (size_t offset = 0; offset != block; ++offset) {
+            out[idx + offset] =
+                static_cast<T>(start + static_cast<U>(idx + offset));
+        }
+    }
+
+    for (; idx < size; ++idx) {
+        out[idx] = static_cast<T>(start + static_cast<U>(idx));
+    }
+}
+
 template <typename Container, typename Range>
 concept try_non_recursive_conversion = !input_range<Container> ||
     std::convertible_to<range_reference_t<Range>, range_value_t<Container>>;
@@ -68,10 +331,47 @@ constexpr C to(R&& range, Args&&... args) {
         "The target must be a class type or union type");
 
     if constexpr (details::try_non_recursive_conversion<C, R>) {
+        // Case 0 -- take over the container owned by an expiring view.
+        if constexpr (details::adoptable_container<C, R, Args...>) {
+            using owner = details::owned_container<std::remove_reference_t<R>>;
+            return C(owner::release(__RXX move(range)),
+                __RXX forward<Args>(args)...);
+        }
         // Case 1 -- construct directly from the given range.
-        if constexpr (std::constructible_from<C, R, Args...>) {
+        else if constexpr (std::constructible_from<C, R, Args...>) {
             return C(__RXX forward<R>(range), __RXX forward<Args>(args)...);
         }
+        // Case 1a -- append a segmented range segment by segment, reserving
+        // the size up front from a hint or a walk over the segment bounds.
+        else if constexpr (details::segment_appendable<C, R, Args...>) {
+            C result(__RXX forward<Args>(args)...);
+            if constexpr (approximately_sized_range<R> &&
+                details::presizable_container<C>) {
+                result.reserve(
+                    static_cast<range_size_t<C>>(ranges::reserve_hint(range)));
+            } else if constexpr (details::presizable_container<C>) {
+                // Only the segment bounds are read, so no element is
+                // dereferenced twice
+                range_size_t<C> total = 0;
+                if (details::sum_segment_sizes(range, total)) {
+                    result.reserve(total);
+                }
+            }
+
+            details::append_segments(result, range);
+            return result;
+        }
+        // Case 1b -- fill from a repeated value or an integer sequence.
+        else if constexpr (details::repeat_fillable<C, R, Args...>) {
+            return C(static_cast<range_size_t<C>>(ranges::size(range)),
+                *ranges::begin(range), __RXX forward<Args>(args)...);
+        } else if constexpr (details::iota_fillable<C, R, Args...>) {
+            C result(__RXX forward<Args>(args)...);
+            result.resize(static_cast<range_size_t<C>>(ranges::size(range)));
+            details::fill_iota(ranges::data(result), ranges::size(result),
+                *ranges::begin(range));
+            return result;
+        }
 #if RXX_SUPPORTS_FROM_RANGE
         // Case 2 -- construct using the `from_range_t` tagged constructor.
         else if constexpr (std::constructible_from<C, std::from_range_t, R,
@@ -81,58 +381,49 @@ constexpr C to(R&& range, Args&&... args) {
         }
 #endif
 
-        // Case 3 -- construct from a begin-end iterator pair.
-        else if constexpr (details::constructible_from_iter_pair<C, R,
-                               Args...>) {
+        // Case 3 -- construct from a begin-end iterator pair, passed as raw
+        // pointers where that lets the container copy the elements in bulk.
+        else if constexpr (details::bulk_constructible<C, R, Args...>) {
+            auto const first = ranges::data(range);
+            return C(first, first + ranges::size(range),
+                __RXX forward<Args>(args)...);
+        } else if constexpr (details::constructible_from_iter_pair<C, R,
+                                 Args...>) {
             return C(ranges::begin(range), ranges::end(range),
                 __RXX forward<Args>(args)...);
         }
 
         // Case 4 -- default-construct (or construct from the extra arguments)
-        // and insert, reserving the size if possible.
+        // and append, reserving the size (or buckets) if possible.
         else {
             static_assert(std::constructible_from<C, Args...> &&
                     details::container_appendable<C, range_reference_t<R>>,
                 "ranges::to: unable to convert to the given container type.");
 
             C result(__RXX forward<Args>(args)...);
-            if constexpr (sized_range<R> && details::reservable_container<C>) {
+            if constexpr (approximately_sized_range<R> &&
+                details::presizable_container<C>) {
                 result.reserve(
-                    static_cast<range_size_t<C>>(ranges::size(range)));
+                    static_cast<range_size_t<C>>(ranges::reserve_hint(range)));
             }
 
-            for (auto&& ref : range) {
-                using RefType = decltype(ref);
-                if constexpr ( //
-                    requires {
-                        result.emplace_back(std::declval<RefType>());
-                    }) {
-                    result.emplace_back(__RXX forward<RefType>(ref));
-                } else if constexpr ( //
-                    requires { result.push_back(std::declval<RefType>()); }) {
-                    result.push_back(__RXX forward<RefType>(ref));
-                } else if constexpr ( //
-                    requires {
-                        result.emplace(result.end(), std::declval<RefType>());
-                    }) {
-                    result.emplace(result.end(), __RXX forward<RefType>(ref));
-                } else {
-                    static_assert(requires {
-                        result.insert(result.end(), std::declval<RefType>());
-                    });
-                    result.insert(result.end(), __RXX forward<RefType>(ref));
-                }
-            }
+            details::container_append_range(result, __RXX forward<R>(range));
             return result;
         }
     } else {
         static_assert(input_range<range_reference_t<R>>,
             "ranges::to: unable to convert to the given container type.");
-        return ranges::to<C>(
-            ref_view(range) | views::transform([]<typename T>(T&& item) {
-                return ranges::to<range_value_t<C>>(__RXX forward<T>(item));
-            }),
-            __RXX forward<Args>(args)...);
+        auto convert = []<typename T>(T&& item) {
+            return ranges::to<range_value_t<C>>(__RXX forward<T>(item));
+        };
+        if constexpr (details::expiring_owner<R>) {
+            return ranges::to<C>(
+                ref_view(range) | views::as_rvalue | views::transform(convert),
+                __RXX forward<Args>(args)...);
+        } else {
+            return ranges::to<C>(ref_view(range) | views::transform(convert),
+                __RXX forward<Args>(args)...);
+        }
     }
 }
 
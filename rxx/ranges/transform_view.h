@@ -3,16 +3,89 @@
 
 #include "rxx/config.h"
 
+#include "rxx/details/adaptor_closure.h"
+#include "rxx/utility.h"
+
+#include <functional>
 #include <ranges>
+#include <type_traits>
 
 RXX_DEFAULT_NAMESPACE_BEGIN
 namespace ranges {
 
 using std::ranges::transform_view;
 
+namespace details {
+/** The functions of two stacked transforms, applied in order. */
+template <typename First, typename Second>
+struct composed_function {
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) First first;
+    RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) Second second;
+
+    template <typename T>
+    requires std::regular_invocable<First&, T> &&
+        std::regular_invocable<Second&, std::invoke_result_t<First&, T>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr decltype(auto) operator()(T&& value) {
+        return std::invoke(second, std::invoke(first, __RXX forward<T>(value)));
+    }
+
+    template <typename T>
+    requires std::regular_invocable<First const&, T> &&
+        std::regular_invocable<Second const&,
+            std::invoke_result_t<First const&, T>>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr decltype(auto) operator()(T&& value) const {
+        return std::invoke(second, std::invoke(first, __RXX forward<T>(value)));
+    }
+};
+} // namespace details
+
 namespace views {
+namespace details {
+struct transform_t : ranges::details::adaptor_non_closure<transform_t> {
+
+    template <typename R, typename F>
+    requires requires {
+        std::views::transform(std::declval<R>(), std::declval<F>());
+    }
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(R&& arg, F&& func) RXX_CONST_CALL
+        noexcept(noexcept(std::views::transform(
+            std::declval<R>(), std::declval<F>()))) {
+        return std::views::transform(
+            __RXX forward<R>(arg), __RXX forward<F>(func));
+    }
+
+    template <typename F>
+    requires std::constructible_from<std::decay_t<F>, F>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    RXX_STATIC_CALL constexpr auto operator()(F&& func) RXX_CONST_CALL
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>) {
+        return __RXX ranges::details::fusable_closure<transform_t,
+            std::decay_t<F>>(__RXX forward<F>(func));
+    }
+
+    /**
+     * `transform(f) | transform(g)` composed as closures becomes
+     * `transform(g . f)`, so the pipeline builds one transform_view instead
+     * of nesting two. Applying `transform(g)` to a range that is already a
+     * transform_view, as in `v | transform(f) | transform(g)`, still nests,
+     * since the standard transform_view does not expose its function.
+     */
+    template <typename F, typename G>
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    static constexpr auto fuse(F&& first, G&& second) {
+        using Composed = __RXX ranges::details::composed_function<
+            std::decay_t<F>, std::decay_t<G>>;
+        return transform_t{}(
+            Composed{__RXX forward<F>(first), __RXX forward<G>(second)});
+    }
+};
+} // namespace details
+
 inline namespace cpo {
-inline constexpr std::decay_t<decltype(std::views::transform)> transform{};
+inline constexpr details::transform_t transform{};
 }
 } // namespace views
 } // namespace ranges
@@ -94,6 +94,20 @@ public:
         return zip_.size();
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires approximately_sized_range<InnerView>
+    {
+        return zip_.reserve_hint();
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires approximately_sized_range<InnerView const>
+    {
+        return zip_.reserve_hint();
+    }
+
 private:
     template <bool Const>
     struct iter_cat {};
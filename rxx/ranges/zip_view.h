@@ -133,6 +133,32 @@ public:
             details::transform(ranges::size, views_));
     }
 
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint()
+    requires (approximately_sized_range<Rs> && ...)
+    {
+        return apply(
+            [](auto... sizes) {
+                using common = std::make_unsigned_t<
+                    std::common_type_t<decltype(sizes)...>>;
+                return ranges::min({common(sizes)...});
+            },
+            details::transform(ranges::reserve_hint, views_));
+    }
+
+    RXX_ATTRIBUTES(_HIDE_FROM_ABI, NODISCARD)
+    constexpr auto reserve_hint() const
+    requires (approximately_sized_range<Rs const> && ...)
+    {
+        return apply(
+            [](auto... sizes) {
+                using common = std::make_unsigned_t<
+                    std::common_type_t<decltype(sizes)...>>;
+                return ranges::min({common(sizes)...});
+            },
+            details::transform(ranges::reserve_hint, views_));
+    }
+
 private:
     RXX_ATTRIBUTE(NO_UNIQUE_ADDRESS) tuple<Rs...> views_;
 };